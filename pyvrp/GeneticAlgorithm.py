@@ -1,12 +1,15 @@
 from __future__ import annotations
 
 import time
+from collections import Counter
 from dataclasses import dataclass
 from typing import TYPE_CHECKING, Callable, Collection
 
 from pyvrp.ProgressPrinter import ProgressPrinter
 from pyvrp.Result import Result
 from pyvrp.Statistics import Statistics
+from pyvrp._pyvrp import Route, RoutePool, Solution
+from pyvrp.crossover import AdaptiveCrossover
 
 if TYPE_CHECKING:
     from pyvrp.PenaltyManager import PenaltyManager
@@ -15,7 +18,6 @@ if TYPE_CHECKING:
         CostEvaluator,
         ProblemData,
         RandomNumberGenerator,
-        Solution,
     )
     from pyvrp.search.SearchMethod import SearchMethod
     from pyvrp.stop.StoppingCriterion import StoppingCriterion
@@ -35,6 +37,19 @@ class GeneticAlgorithmParams:
     nb_iter_no_improvement
         Number of iterations without any improvement needed before a restart
         occurs.
+    nb_iter_route_pool
+        Number of iterations between route pool recombination stages. In such
+        a stage, feasible routes collected from the solutions added to the
+        population are recombined into a new solution, which is then improved
+        and added to the population. Default 0, which disables the stage.
+    route_pool_size
+        Maximum number of routes kept in the route pool.
+    register_routes
+        Whether to register the feasibility of each route of the improved
+        offspring with the penalty manager, rather than that of the offspring
+        as a whole. Since a single infeasible route does not make the other
+        routes infeasible, this gives the penalty manager a finer-grained
+        signal. Default ``False``.
 
     Attributes
     ----------
@@ -42,16 +57,27 @@ class GeneticAlgorithmParams:
         Probability of repairing an infeasible solution.
     nb_iter_no_improvement
         Number of iterations without improvement before a restart occurs.
+    nb_iter_route_pool
+        Number of iterations between route pool recombination stages.
+    route_pool_size
+        Maximum number of routes kept in the route pool.
+    register_routes
+        Whether to register routes rather than solutions with the penalty
+        manager.
 
     Raises
     ------
     ValueError
         When ``repair_probability`` is not in :math:`[0, 1]`, or
-        ``nb_iter_no_improvement`` is negative.
+        ``nb_iter_no_improvement`` or ``nb_iter_route_pool`` is negative, or
+        ``route_pool_size`` is not positive.
     """
 
     repair_probability: float = 0.80
     nb_iter_no_improvement: int = 20_000
+    nb_iter_route_pool: int = 0
+    route_pool_size: int = 1_000
+    register_routes: bool = False
 
     def __post_init__(self):
         if not 0 <= self.repair_probability <= 1:
@@ -60,6 +86,12 @@ class GeneticAlgorithmParams:
         if self.nb_iter_no_improvement < 0:
             raise ValueError("nb_iter_no_improvement < 0 not understood.")
 
+        if self.nb_iter_route_pool < 0:
+            raise ValueError("nb_iter_route_pool < 0 not understood.")
+
+        if self.route_pool_size <= 0:
+            raise ValueError("route_pool_size <= 0 not understood.")
+
 
 class GeneticAlgorithm:
     """
@@ -78,16 +110,28 @@ class GeneticAlgorithm:
     search_method
         Search method to use.
     crossover_op
-        Crossover operator to use for generating offspring.
+        Crossover operator to use for generating offspring. When this is an
+        :class:`~pyvrp.crossover.AdaptiveCrossover`, the improvement and CPU
+        time of each offspring are reported back to the operator.
     initial_solutions
         Initial solutions to use to initialise the population.
     params
         Genetic algorithm parameters. If not provided, a default will be used.
+    frozen_routes
+        Routes, or route prefixes, that must be kept as they are, for example
+        because they have already been dispatched. Each solution, including
+        each initial solution and offspring, is made to contain these routes:
+        the remaining clients of a solution route containing a frozen route's
+        first client are appended to it, and the other solution routes are
+        kept without any frozen clients. The search method should likewise
+        keep these routes fixed, see
+        :meth:`~pyvrp.search.LocalSearch.LocalSearch.set_frozen_clients`.
 
     Raises
     ------
     ValueError
-        When the population is empty.
+        When the population is empty, or when the frozen routes use more
+        vehicles of some type than are available.
     """
 
     def __init__(
@@ -108,22 +152,40 @@ class GeneticAlgorithm:
         ],
         initial_solutions: Collection[Solution],
         params: GeneticAlgorithmParams = GeneticAlgorithmParams(),
+        frozen_routes: Collection[Route] = (),
     ):
         if len(initial_solutions) == 0:
             raise ValueError("Expected at least one initial solution.")
 
+        num_frozen = Counter(route.vehicle_type() for route in frozen_routes)
+        for veh_type, num_used in num_frozen.items():
+            if num_used > data.vehicle_type(veh_type).num_available:
+                raise ValueError("Frozen routes use too many vehicles.")
+
         self._data = data
         self._pm = penalty_manager
         self._rng = rng
         self._pop = population
         self._search = search_method
         self._crossover = crossover_op
-        self._initial_solutions = initial_solutions
         self._params = params
+        self._frozen_routes = [route for route in frozen_routes if route]
+        self._frozen_clients = {
+            client for route in self._frozen_routes for client in route
+        }
+
+        self._initial_solutions = [
+            self._restore_frozen(sol) for sol in initial_solutions
+        ]
+
+        self._pool = None
+        if params.nb_iter_route_pool > 0:
+            self._pool = RoutePool(data, params.route_pool_size)
 
         # Find best feasible initial solution if any exist, else set a random
         # infeasible solution (with infinite cost) as the initial best.
-        self._best = min(initial_solutions, key=self._cost_evaluator.cost)
+        init = self._initial_solutions
+        self._best = min(init, key=self._cost_evaluator.cost)
 
     @property
     def _cost_evaluator(self) -> CostEvaluator:
@@ -182,11 +244,28 @@ class GeneticAlgorithm:
 
             curr_best = self._cost_evaluator.cost(self._best)
 
+            start_offspring = time.thread_time()
             parents = self._pop.select(self._rng, self._cost_evaluator)
             offspring = self._crossover(
                 parents, self._data, self._cost_evaluator, self._rng
             )
-            self._improve_offspring(offspring)
+            improved = self._improve_offspring(self._restore_frozen(offspring))
+
+            if isinstance(self._crossover, AdaptiveCrossover):
+                # Reward the crossover operator with the improvement over the
+                # best parent, per unit of CPU time spent on this offspring.
+                cost_eval = self._cost_evaluator
+                parent_cost = min(map(cost_eval.penalised_cost, parents))
+                improvement = parent_cost - cost_eval.penalised_cost(improved)
+                duration = time.thread_time() - start_offspring
+                self._crossover.update(improvement, duration)
+
+            if (
+                self._pool is not None
+                and iters % self._params.nb_iter_route_pool == 0
+            ):
+                combined = self._pool.combine()
+                self._improve_offspring(self._restore_frozen(combined))
 
             new_best = self._cost_evaluator.cost(self._best)
 
@@ -205,15 +284,15 @@ class GeneticAlgorithm:
 
         return res
 
-    def _improve_offspring(self, sol: Solution):
+    def _improve_offspring(self, sol: Solution) -> Solution:
         def is_new_best(sol):
             cost = self._cost_evaluator.cost(sol)
             best_cost = self._cost_evaluator.cost(self._best)
             return cost < best_cost
 
-        sol = self._search(sol, self._cost_evaluator)
-        self._pop.add(sol, self._cost_evaluator)
-        self._pm.register(sol)
+        sol = improved = self._search(sol, self._cost_evaluator)
+        self._add(sol)
+        self._register(sol)
 
         if is_new_best(sol):
             self._best = sol
@@ -227,8 +306,72 @@ class GeneticAlgorithm:
             sol = self._search(sol, self._pm.booster_cost_evaluator())
 
             if sol.is_feasible():
-                self._pop.add(sol, self._cost_evaluator)
-                self._pm.register(sol)
+                self._add(sol)
+                self._register(sol)
 
             if is_new_best(sol):
                 self._best = sol
+
+        return improved
+
+    def _add(self, sol: Solution):
+        self._pop.add(sol, self._cost_evaluator)
+
+        if self._pool is not None:
+            self._pool.add(sol)
+
+    def _register(self, sol: Solution):
+        if self._params.register_routes:
+            for route in sol.routes():
+                self._pm.register_route(route)
+        else:
+            self._pm.register(sol)
+
+    def _restore_frozen(self, sol: Solution) -> Solution:
+        """
+        Returns a solution that contains the frozen routes. Crossover can
+        break up the frozen routes of its parents, so this puts them back.
+        """
+        if not self._frozen_routes:
+            return sol
+
+        routes = sol.routes()
+        route_of = {c: idx for idx, route in enumerate(routes) for c in route}
+
+        # Each frozen route continues with the other clients of the solution
+        # route that visits its first client, unless another frozen route has
+        # already claimed that solution route.
+        claimed = set()
+        new_routes = []
+        for frozen in self._frozen_routes:
+            visits = frozen.visits()
+            idx = route_of.get(visits[0])
+
+            if idx is not None and idx not in claimed:
+                claimed.add(idx)
+                visits += [
+                    client
+                    for client in routes[idx]
+                    if client not in self._frozen_clients
+                ]
+
+            new_routes.append((visits, frozen.vehicle_type()))
+
+        # The other routes are kept without their frozen clients, as long as
+        # there are vehicles available for them. Clients in routes that do
+        # not fit are left unassigned, for the search to insert.
+        num_used = Counter(veh_type for _, veh_type in new_routes)
+        for idx, route in enumerate(routes):
+            if idx in claimed:
+                continue
+
+            visits = [c for c in route if c not in self._frozen_clients]
+            veh_type = route.vehicle_type()
+            num_avail = self._data.vehicle_type(veh_type).num_available
+
+            if visits and num_used[veh_type] < num_avail:
+                new_routes.append((visits, veh_type))
+                num_used[veh_type] += 1
+
+        data = self._data
+        return Solution(data, [Route(data, *args) for args in new_routes])
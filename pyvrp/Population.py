@@ -75,7 +75,8 @@ class Population:
     def add(self, solution: Solution, cost_evaluator: CostEvaluator):
         """
         Inserts the given solution in the appropriate feasible or infeasible
-        (sub)population.
+        (sub)population. Solutions that are already in the population are not
+        added again.
 
         .. note::
 
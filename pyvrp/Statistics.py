@@ -127,10 +127,9 @@ class Statistics:
             )
 
         size = len(subpop)
-        costs = [
-            cost_evaluator.penalised_cost(item.solution) for item in subpop
-        ]
-        num_routes = [item.solution.num_routes() for item in subpop]
+        solutions = [item.solution for item in subpop]
+        costs = cost_evaluator.penalised_costs(solutions).tolist()
+        num_routes = [sol.num_routes() for sol in solutions]
         diversities = [item.avg_distance_closest() for item in subpop]
 
         return _Datum(
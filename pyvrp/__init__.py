@@ -17,10 +17,12 @@ from ._pyvrp import DynamicBitset as DynamicBitset
 from ._pyvrp import ProblemData as ProblemData
 from ._pyvrp import RandomNumberGenerator as RandomNumberGenerator
 from ._pyvrp import Route as Route
+from ._pyvrp import RoutePool as RoutePool
 from ._pyvrp import Solution as Solution
 from ._pyvrp import VehicleType as VehicleType
 from .read import read as read
 from .read import read_solution as read_solution
 from .show_versions import show_versions as show_versions
 from .solve import SolveParams as SolveParams
+from .solve import Solver as Solver
 from .solve import solve as solve
@@ -1,4 +1,4 @@
-from typing import Callable, Iterator, Optional, Union, overload
+from typing import Callable, ClassVar, Iterator, Optional, Union, overload
 
 import numpy as np
 
@@ -11,6 +11,10 @@ class CostEvaluator:
     def dist_penalty(self, distance: int, max_distance: int) -> int: ...
     def penalised_cost(self, solution: Solution) -> int: ...
     def cost(self, solution: Solution) -> int: ...
+    def penalised_costs(
+        self, solutions: list[Solution]
+    ) -> np.ndarray[int]: ...
+    def costs(self, solutions: list[Solution]) -> np.ndarray[int]: ...
 
 class DynamicBitset:
     def __init__(self, num_bits: int) -> None: ...
@@ -171,6 +175,7 @@ class Route:
     def __iter__(self) -> Iterator[int]: ...
     def __len__(self) -> int: ...
     def __eq__(self, other: object) -> bool: ...
+    def __hash__(self) -> int: ...
     def is_feasible(self) -> bool: ...
     def has_excess_load(self) -> bool: ...
     def has_excess_distance(self) -> bool: ...
@@ -226,6 +231,8 @@ class Solution:
     def prizes(self) -> int: ...
     def uncollected_prizes(self) -> int: ...
     def is_feasible(self) -> bool: ...
+    @staticmethod
+    def are_feasible(solutions: list[Solution]) -> np.ndarray[bool]: ...
     def is_group_feasible(self) -> bool: ...
     def is_complete(self) -> bool: ...
     def num_routes(self) -> int: ...
@@ -280,6 +287,64 @@ class SubPopulationItem:
     def solution(self) -> Solution: ...
     def avg_distance_closest(self) -> float: ...
 
+class RoutePool:
+    def __init__(self, data: ProblemData, max_size: int = 1_000) -> None: ...
+    def add(self, solution: Solution) -> None: ...
+    def combine(self) -> Solution: ...
+    def clear(self) -> None: ...
+    def __len__(self) -> int: ...
+    @property
+    def max_size(self) -> int: ...
+
+class PenaltyParams:
+    repair_booster: int
+    solutions_between_updates: int
+    penalty_increase: float
+    penalty_decrease: float
+    target_feasible: float
+    def __init__(
+        self,
+        repair_booster: int = 12,
+        solutions_between_updates: int = 50,
+        penalty_increase: float = 1.34,
+        penalty_decrease: float = 0.32,
+        target_feasible: float = 0.43,
+    ) -> None: ...
+    def __eq__(self, other: object) -> bool: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, state: tuple, /) -> None: ...
+
+class PenaltyManager:
+    MIN_PENALTY: ClassVar[float]
+    MAX_PENALTY: ClassVar[float]
+    FEAS_TOL: ClassVar[float]
+    def __init__(
+        self,
+        params: PenaltyParams = ...,
+        initial_penalties: tuple[float, float, float] = (20, 6, 6),
+    ) -> None: ...
+    @staticmethod
+    def init_from(
+        data: ProblemData,
+        params: PenaltyParams = ...,
+    ) -> PenaltyManager: ...
+    def register(self, solution: Solution) -> None: ...
+    def register_route(self, route: Route) -> None: ...
+    def cost_evaluator(self) -> CostEvaluator: ...
+    def booster_cost_evaluator(self) -> CostEvaluator: ...
+    def penalties(self) -> list[float]: ...
+    @property
+    def params(self) -> PenaltyParams: ...
+    def __copy__(self) -> PenaltyManager: ...
+    def __deepcopy__(self, memo: dict) -> PenaltyManager: ...
+
+def average_best_edges(data: ProblemData) -> tuple[float, float, float]: ...
+def split(
+    data: ProblemData,
+    tour: list[int],
+    cost_evaluator: CostEvaluator,
+) -> list[Route]: ...
+
 class DistanceSegment:
     def __init__(
         self,
@@ -0,0 +1,3 @@
+from ._construct import regret_insertion as regret_insertion
+from ._construct import savings as savings
+from ._construct import sweep as sweep
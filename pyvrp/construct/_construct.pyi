@@ -0,0 +1,21 @@
+from pyvrp import CostEvaluator, ProblemData, RandomNumberGenerator, Solution
+
+def regret_insertion(
+    data: ProblemData,
+    cost_evaluator: CostEvaluator,
+    rng: RandomNumberGenerator,
+    neighbours: list[list[int]] = [],
+    num_regret: int = 2,
+) -> Solution: ...
+def savings(
+    data: ProblemData,
+    cost_evaluator: CostEvaluator,
+    rng: RandomNumberGenerator,
+    neighbours: list[list[int]],
+) -> Solution: ...
+def sweep(
+    data: ProblemData,
+    cost_evaluator: CostEvaluator,
+    rng: RandomNumberGenerator,
+    neighbours: list[list[int]] = [],
+) -> Solution: ...
@@ -6,6 +6,7 @@
 
 #include <concepts>
 #include <limits>
+#include <vector>
 
 namespace pyvrp
 {
@@ -68,6 +69,9 @@ class CostEvaluator
 public:
     CostEvaluator(Cost loadPenalty, Cost twPenalty, Cost distPenalty);
 
+    // Two cost evaluators are equal when all their penalty terms are equal.
+    bool operator==(CostEvaluator const &other) const = default;
+
     /**
      * Computes the total excess load penalty for the given load and vehicle
      * capacity.
@@ -128,6 +132,28 @@ public:
     // method for the Solution class.
     template <CostEvaluatable T> [[nodiscard]] Cost cost(T const &arg) const;
 
+    /**
+     * Computes the penalised cost of each of the given solutions, in order.
+     * This is equivalent to, but more efficient than, calling
+     * :meth:`penalised_cost` on each solution separately.
+     */
+    // The docstring above is written for Python, where we only expose this
+    // method for lists of Solutions.
+    template <CostEvaluatable T>
+    [[nodiscard]] std::vector<Cost>
+    penalisedCosts(std::vector<T const *> const &args) const;
+
+    /**
+     * Computes the objective value of each of the given solutions, in order.
+     * This is equivalent to, but more efficient than, calling :meth:`cost` on
+     * each solution separately.
+     */
+    // The docstring above is written for Python, where we only expose this
+    // method for lists of Solutions.
+    template <CostEvaluatable T>
+    [[nodiscard]] std::vector<Cost>
+    costs(std::vector<T const *> const &args) const;
+
     /**
      * Evaluates the cost delta of the given route proposal, and writes the
      * resulting cost delta to the ``out`` parameter. The evaluation can be
@@ -212,6 +238,31 @@ template <CostEvaluatable T> Cost CostEvaluator::cost(T const &arg) const
                             : std::numeric_limits<Cost>::max();
 }
 
+template <CostEvaluatable T>
+std::vector<Cost>
+CostEvaluator::penalisedCosts(std::vector<T const *> const &args) const
+{
+    std::vector<Cost> out;
+    out.reserve(args.size());
+
+    for (auto const *arg : args)
+        out.push_back(penalisedCost(*arg));
+
+    return out;
+}
+
+template <CostEvaluatable T>
+std::vector<Cost> CostEvaluator::costs(std::vector<T const *> const &args) const
+{
+    std::vector<Cost> out;
+    out.reserve(args.size());
+
+    for (auto const *arg : args)
+        out.push_back(cost(*arg));
+
+    return out;
+}
+
 template <bool exact,
           bool skipLoad,
           typename... Args,
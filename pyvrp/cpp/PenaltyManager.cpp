@@ -0,0 +1,216 @@
+#include "PenaltyManager.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+using pyvrp::Cost;
+using pyvrp::CostEvaluator;
+using pyvrp::Distance;
+using pyvrp::Duration;
+using pyvrp::PenaltyManager;
+using pyvrp::PenaltyParams;
+
+PenaltyParams::PenaltyParams(int repairBooster,
+                             int solutionsBetweenUpdates,
+                             double penaltyIncrease,
+                             double penaltyDecrease,
+                             double targetFeasible)
+    : repairBooster(static_cast<size_t>(repairBooster)),
+      solutionsBetweenUpdates(static_cast<size_t>(solutionsBetweenUpdates)),
+      penaltyIncrease(penaltyIncrease),
+      penaltyDecrease(penaltyDecrease),
+      targetFeasible(targetFeasible)
+{
+    if (repairBooster < 1)
+        throw std::invalid_argument("Expected repair_booster >= 1.");
+
+    if (solutionsBetweenUpdates < 1)
+        throw std::invalid_argument("Expected solutions_between_updates >= 1.");
+
+    if (!(penaltyIncrease >= 1.0))
+        throw std::invalid_argument("Expected penalty_increase >= 1.");
+
+    if (!(0.0 <= penaltyDecrease && penaltyDecrease <= 1.0))
+        throw std::invalid_argument("Expected penalty_decrease in [0, 1].");
+
+    if (!(0.0 <= targetFeasible && targetFeasible <= 1.0))
+        throw std::invalid_argument("Expected target_feasible in [0, 1].");
+}
+
+PenaltyManager::PenaltyManager(PenaltyParams params,
+                               std::array<double, 3> const &initialPenalties)
+    : params_(params)
+{
+    for (size_t idx = 0; idx != penalties_.size(); ++idx)
+        penalties_[idx]
+            = std::clamp(initialPenalties[idx], MIN_PENALTY, MAX_PENALTY);
+}
+
+PenaltyManager PenaltyManager::initFrom(ProblemData const &data,
+                                        PenaltyParams params)
+{
+    // Best edge cost/distance/duration over all vehicle types and profiles,
+    // and then average that for the entire matrix to obtain an "average best"
+    // edge cost/distance/duration.
+    auto const [avgCost, avgDist, avgDur] = averageBestEdges(data);
+
+    double avgLoad = 0;
+    if (data.numClients() != 0)
+    {
+        for (auto const &client : data.clients())
+            avgLoad += static_cast<double>(
+                std::max(client.pickup, client.delivery).get());
+
+        avgLoad /= static_cast<double>(data.numClients());
+    }
+
+    // Initial penalty parameters are meant to weigh an average increase in the
+    // relevant value by the same amount as the average edge cost. We round
+    // half to even, like Python's round() does.
+    auto const initLoad = std::nearbyint(avgCost / std::max(avgLoad, 1.0));
+    auto const initTw = std::nearbyint(avgCost / std::max(avgDur, 1.0));
+    auto const initDist = std::nearbyint(avgCost / std::max(avgDist, 1.0));
+    return {params, {initLoad, initTw, initDist}};
+}
+
+double PenaltyManager::compute(double penalty, bool increase) const
+{
+    // +/- 1 to ensure we do not get stuck at the same integer values.
+    auto const newPenalty = increase ? params_.penaltyIncrease * penalty + 1
+                                     : params_.penaltyDecrease * penalty - 1;
+
+    return std::trunc(std::clamp(newPenalty, MIN_PENALTY, MAX_PENALTY));
+}
+
+bool PenaltyManager::registerFeasibility(std::array<bool, 3> const &isFeasible)
+{
+    bool atMax = false;
+    for (size_t idx = 0; idx != penalties_.size(); ++idx)
+    {
+        auto &regs = registrations_[idx];
+        regs.numRegistered++;
+        regs.numFeasible += isFeasible[idx];
+
+        if (regs.numRegistered != params_.solutionsBetweenUpdates)
+            continue;
+
+        auto const feasPct = static_cast<double>(regs.numFeasible)
+                             / static_cast<double>(regs.numRegistered);
+        auto const diff = params_.targetFeasible - feasPct;
+        regs = {};
+
+        if (std::abs(diff) < FEAS_TOL)  // close enough to the target, so
+            continue;                   // there is no need to update.
+
+        penalties_[idx] = compute(penalties_[idx], diff > 0);
+        atMax |= penalties_[idx] == MAX_PENALTY;
+    }
+
+    return atMax;
+}
+
+bool PenaltyManager::registerSolution(Solution const &solution)
+{
+    return registerFeasibility({!solution.hasExcessLoad(),
+                                !solution.hasTimeWarp(),
+                                !solution.hasExcessDistance()});
+}
+
+bool PenaltyManager::registerRoute(Route const &route)
+{
+    return registerFeasibility({!route.hasExcessLoad(),
+                                !route.hasTimeWarp(),
+                                !route.hasExcessDistance()});
+}
+
+CostEvaluator PenaltyManager::costEvaluator() const
+{
+    return {penalties_[0], penalties_[1], penalties_[2]};
+}
+
+CostEvaluator PenaltyManager::boosterCostEvaluator() const
+{
+    auto const booster = static_cast<double>(params_.repairBooster);
+    return {penalties_[0] * booster,
+            penalties_[1] * booster,
+            penalties_[2] * booster};
+}
+
+std::array<double, 3> const &PenaltyManager::penalties() const
+{
+    return penalties_;
+}
+
+PenaltyParams const &PenaltyManager::params() const { return params_; }
+
+std::tuple<double, double, double>
+pyvrp::averageBestEdges(ProblemData const &data)
+{
+    struct EdgeCost
+    {
+        size_t profile;
+        Cost unitDistanceCost;
+        Cost unitDurationCost;
+
+        bool operator==(EdgeCost const &other) const = default;
+    };
+
+    // Vehicle types with the same profile and unit costs have the same edge
+    // costs, so we only need to consider each such combination once.
+    std::vector<EdgeCost> edgeCosts;
+    for (auto const &vehType : data.vehicleTypes())
+    {
+        EdgeCost const edgeCost = {vehType.profile,
+                                   vehType.unitDistanceCost,
+                                   vehType.unitDurationCost};
+
+        if (std::find(edgeCosts.begin(), edgeCosts.end(), edgeCost)
+            == edgeCosts.end())
+            edgeCosts.push_back(edgeCost);
+    }
+
+    auto const &distMats = data.distanceMatrices();
+    auto const &durMats = data.durationMatrices();
+
+    // We accumulate in floating point. Edges to and from locations that
+    // cannot be visited are set to a very large value, and summing many of
+    // those in the (integral) measure types could overflow.
+    double totalCost = 0;
+    double totalDist = 0;
+    double totalDur = 0;
+
+    for (size_t frm = 0; frm != data.numLocations(); ++frm)
+        for (size_t to = 0; to != data.numLocations(); ++to)
+        {
+            auto cost = std::numeric_limits<double>::max();
+            for (auto const &[profile, unitDistCost, unitDurCost] : edgeCosts)
+            {
+                auto const dist = distMats[profile](frm, to).get();
+                auto const dur = durMats[profile](frm, to).get();
+                cost = std::min(
+                    cost,
+                    static_cast<double>(unitDistCost.get()) * dist
+                        + static_cast<double>(unitDurCost.get()) * dur);
+            }
+
+            auto dist = std::numeric_limits<Distance>::max();
+            for (auto const &mat : distMats)
+                dist = std::min(dist, mat(frm, to));
+
+            auto dur = std::numeric_limits<Duration>::max();
+            for (auto const &mat : durMats)
+                dur = std::min(dur, mat(frm, to));
+
+            totalCost += edgeCosts.empty() ? 0 : cost;
+            totalDist += static_cast<double>(dist.get());
+            totalDur += static_cast<double>(dur.get());
+        }
+
+    auto const numEdges = static_cast<double>(data.numLocations())
+                          * static_cast<double>(data.numLocations());
+
+    return {totalCost / numEdges, totalDist / numEdges, totalDur / numEdges};
+}
@@ -0,0 +1,234 @@
+#ifndef PYVRP_PENALTYMANAGER_H
+#define PYVRP_PENALTYMANAGER_H
+
+#include "CostEvaluator.h"
+#include "ProblemData.h"
+#include "Route.h"
+#include "Solution.h"
+
+#include <array>
+#include <tuple>
+
+namespace pyvrp
+{
+/**
+ * PenaltyParams(
+ *     repair_booster: int = 12,
+ *     solutions_between_updates: int = 50,
+ *     penalty_increase: float = 1.34,
+ *     penalty_decrease: float = 0.32,
+ *     target_feasible: float = 0.43,
+ * )
+ *
+ * The penalty manager parameters.
+ *
+ * Parameters
+ * ----------
+ * repair_booster
+ *     A repair booster value :math:`r \ge 1`. This value is used to
+ *     temporarily multiply the current penalty terms, to force feasibility.
+ *     See also
+ *     :meth:`~pyvrp.PenaltyManager.PenaltyManager.booster_cost_evaluator`.
+ * solutions_between_updates
+ *     Number of feasibility registrations between penalty value updates. The
+ *     penalty manager updates the penalty terms every once in a while based
+ *     on recent feasibility registrations. This parameter controls how often
+ *     such updating occurs.
+ * penalty_increase
+ *     Amount :math:`p_i \ge 1` by which the current penalties are
+ *     increased when insufficient feasible solutions (see
+ *     ``target_feasible``) have been found amongst the most recent
+ *     registrations. The penalty values :math:`v` are updated as
+ *     :math:`v \gets p_i v`.
+ * penalty_decrease
+ *     Amount :math:`p_d \in [0, 1]` by which the current penalties are
+ *     decreased when sufficient feasible solutions (see ``target_feasible``)
+ *     have been found amongst the most recent registrations. The penalty
+ *     values :math:`v` are updated as :math:`v \gets p_d v`.
+ * target_feasible
+ *     Target percentage :math:`p_f \in [0, 1]` of feasible registrations
+ *     in the last ``solutions_between_updates`` registrations. This
+ *     percentage is used to update the penalty terms: when insufficient
+ *     feasible solutions have been registered, the penalties are increased;
+ *     similarly, when too many feasible solutions have been registered, the
+ *     penalty terms are decreased. This ensures a balanced population, with a
+ *     fraction :math:`p_f` feasible and a fraction :math:`1 - p_f` infeasible
+ *     solutions.
+ *
+ * Attributes
+ * ----------
+ * repair_booster
+ *     A repair booster value.
+ * solutions_between_updates
+ *     Number of feasibility registrations between penalty value updates.
+ * penalty_increase
+ *     Amount :math:`p_i \ge 1` by which the current penalties are
+ *     increased when insufficient feasible solutions (see
+ *     ``target_feasible``) have been found amongst the most recent
+ *     registrations.
+ * penalty_decrease
+ *     Amount :math:`p_d \in [0, 1]` by which the current penalties are
+ *     decreased when sufficient feasible solutions (see ``target_feasible``)
+ *     have been found amongst the most recent registrations.
+ * target_feasible
+ *     Target percentage :math:`p_f \in [0, 1]` of feasible registrations
+ *     in the last ``solutions_between_updates`` registrations.
+ *
+ * Raises
+ * ------
+ * ValueError
+ *     When any of the parameters is outside its valid range.
+ */
+struct PenaltyParams
+{
+    size_t const repairBooster;
+    size_t const solutionsBetweenUpdates;
+    double const penaltyIncrease;
+    double const penaltyDecrease;
+    double const targetFeasible;
+
+    PenaltyParams(int repairBooster = 12,
+                  int solutionsBetweenUpdates = 50,
+                  double penaltyIncrease = 1.34,
+                  double penaltyDecrease = 0.32,
+                  double targetFeasible = 0.43);
+
+    bool operator==(PenaltyParams const &other) const = default;
+};
+
+/**
+ * PenaltyManager(
+ *     params: PenaltyParams = PenaltyParams(),
+ *     initial_penalties: tuple[int, int, int] = (20, 6, 6),
+ * )
+ *
+ * Creates a PenaltyManager instance.
+ *
+ * This class manages time warp and load penalties, and provides penalty terms
+ * for given time warp and load values. It updates these penalties based on
+ * recent history, and can be used to provide a temporary penalty booster
+ * object that increases the penalties for a short duration.
+ *
+ * .. note::
+ *
+ *    Consider initialising using :meth:`~init_from` to compute initial
+ *    penalty values that are scaled according to the data instance.
+ *
+ * Parameters
+ * ----------
+ * params
+ *     PenaltyManager parameters. If not provided, a default will be used.
+ * initial_penalties
+ *     Initial penalty values for unit load (idx 0), duration (1), and
+ *     distance (2) violations. Defaults to ``(20, 6, 6)`` for backwards
+ *     compatibility. These values are clipped to the range ``[MIN_PENALTY,
+ *     MAX_PENALTY]``.
+ */
+class PenaltyManager
+{
+public:
+    static constexpr double MIN_PENALTY = 1;
+    static constexpr double MAX_PENALTY = 100'000;
+    static constexpr double FEAS_TOL = 0.05;
+
+private:
+    // Feasibility registrations since the last penalty update.
+    struct Registrations
+    {
+        size_t numRegistered = 0;
+        size_t numFeasible = 0;
+    };
+
+    PenaltyParams params_;
+    std::array<double, 3> penalties_;  // load, time warp, distance
+    std::array<Registrations, 3> registrations_;
+
+    // Computes and returns the new penalty value, given the current value and
+    // whether the penalty should increase or decrease.
+    [[nodiscard]] double compute(double penalty, bool increase) const;
+
+    // Registers the feasibility of each penalised dimension, and updates the
+    // penalty values when enough registrations have been collected. Returns
+    // whether any penalty value was updated to MAX_PENALTY.
+    bool registerFeasibility(std::array<bool, 3> const &isFeasible);
+
+public:
+    PenaltyManager(PenaltyParams params = PenaltyParams(),
+                   std::array<double, 3> const &initialPenalties = {20, 6, 6});
+
+    /**
+     * Initialises from the given data instance and parameter object. The
+     * initial penalty values are computed from the problem data.
+     *
+     * Parameters
+     * ----------
+     * data
+     *     Data instance to use when computing penalty values.
+     * params
+     *     PenaltyManager parameters. If not provided, a default will be used.
+     */
+    static PenaltyManager initFrom(ProblemData const &data,
+                                   PenaltyParams params = PenaltyParams());
+
+    // The register methods below return whether any penalty value was updated
+    // to MAX_PENALTY, which usually indicates a hard or infeasible instance.
+
+    /**
+     * Registers the feasibility dimensions of the given solution.
+     */
+    bool registerSolution(Solution const &solution);
+
+    /**
+     * Registers the feasibility dimensions of the given route. This provides
+     * a finer-grained signal than registering entire solutions, since a
+     * single infeasible route does not make all other routes count as
+     * infeasible.
+     */
+    bool registerRoute(Route const &route);
+
+    /**
+     * Get a cost evaluator using the current penalty values.
+     */
+    [[nodiscard]] CostEvaluator costEvaluator() const;
+
+    /**
+     * Get a cost evaluator using the boosted current penalty values.
+     */
+    [[nodiscard]] CostEvaluator boosterCostEvaluator() const;
+
+    /**
+     * Returns the current penalty values for unit load, duration, and distance
+     * violations.
+     */
+    [[nodiscard]] std::array<double, 3> const &penalties() const;
+
+    /**
+     * Returns the penalty manager parameters.
+     */
+    [[nodiscard]] PenaltyParams const &params() const;
+};
+
+/**
+ * Computes the average best edge cost, distance, and duration over all pairs
+ * of locations. The best edge cost of a pair is the cheapest cost of
+ * traversing the edge with any vehicle type. The best distance and duration
+ * are the smallest across all routing profiles. These averages are used to
+ * scale the initial penalty values to the data instance.
+ *
+ * This takes a single pass over the distance and duration matrices, and does
+ * not need any memory beyond those matrices.
+ *
+ * Parameters
+ * ----------
+ * data
+ *     Data instance to compute the averages for.
+ *
+ * Returns
+ * -------
+ * tuple[float, float, float]
+ *     The average best edge cost, distance, and duration.
+ */
+std::tuple<double, double, double> averageBestEdges(ProblemData const &data);
+}  // namespace pyvrp
+
+#endif  // PYVRP_PENALTYMANAGER_H
@@ -257,45 +257,45 @@ ProblemData::VehicleType::~VehicleType() { delete[] name; }
 
 std::vector<ProblemData::Client> const &ProblemData::clients() const
 {
-    return clients_;
+    return *clients_;
 }
 
 std::vector<ProblemData::Depot> const &ProblemData::depots() const
 {
-    return depots_;
+    return *depots_;
 }
 
 std::vector<ProblemData::ClientGroup> const &ProblemData::groups() const
 {
-    return groups_;
+    return *groups_;
 }
 
 std::vector<ProblemData::VehicleType> const &ProblemData::vehicleTypes() const
 {
-    return vehicleTypes_;
+    return *vehicleTypes_;
 }
 
 std::vector<Matrix<Distance>> const &ProblemData::distanceMatrices() const
 {
-    return dists_;
+    return *dists_;
 }
 
 std::vector<Matrix<Duration>> const &ProblemData::durationMatrices() const
 {
-    return durs_;
+    return *durs_;
 }
 
 ProblemData::ClientGroup const &ProblemData::group(size_t group) const
 {
-    assert(group < groups_.size());
-    return groups_[group];
+    assert(group < groups_->size());
+    return (*groups_)[group];
 }
 
 ProblemData::VehicleType const &
 ProblemData::vehicleType(size_t vehicleType) const
 {
-    assert(vehicleType < vehicleTypes_.size());
-    return vehicleTypes_[vehicleType];
+    assert(vehicleType < vehicleTypes_->size());
+    return (*vehicleTypes_)[vehicleType];
 }
 
 std::pair<double, double> const &ProblemData::centroid() const
@@ -303,22 +303,25 @@ std::pair<double, double> const &ProblemData::centroid() const
     return centroid_;
 }
 
-size_t ProblemData::numClients() const { return clients_.size(); }
+size_t ProblemData::numClients() const { return clients_->size(); }
 
-size_t ProblemData::numDepots() const { return depots_.size(); }
+size_t ProblemData::numDepots() const { return depots_->size(); }
 
-size_t ProblemData::numGroups() const { return groups_.size(); }
+size_t ProblemData::numGroups() const { return groups_->size(); }
 
 size_t ProblemData::numLocations() const { return numDepots() + numClients(); }
 
-size_t ProblemData::numVehicleTypes() const { return vehicleTypes_.size(); }
+size_t ProblemData::numVehicleTypes() const
+{
+    return vehicleTypes_->size();
+}
 
 size_t ProblemData::numVehicles() const { return numVehicles_; }
 
 size_t ProblemData::numProfiles() const
 {
-    assert(dists_.size() == durs_.size());
-    return dists_.size();
+    assert(dists_->size() == durs_->size());
+    return dists_->size();
 }
 
 void ProblemData::validate() const
@@ -333,7 +336,7 @@ void ProblemData::validate() const
         if (*client.group >= numGroups())
             throw std::out_of_range("Client references invalid group.");
 
-        auto const &group = groups_[*client.group];
+        auto const &group = (*groups_)[*client.group];
         if (std::find(group.begin(), group.end(), idx) == group.end())
         {
             auto const *msg = "Client not in the group it references.";
@@ -348,13 +351,13 @@ void ProblemData::validate() const
     }
 
     // Depot checks.
-    if (depots_.empty())
+    if (depots_->empty())
         throw std::invalid_argument("Expected at least one depot.");
 
     // Group checks.
     for (size_t idx = 0; idx != numGroups(); ++idx)
     {
-        auto const &group = groups_[idx];
+        auto const &group = (*groups_)[idx];
 
         if (group.empty())
             throw std::invalid_argument("Empty client group not understood.");
@@ -374,7 +377,7 @@ void ProblemData::validate() const
     }
 
     // Vehicle type checks.
-    for (auto const &vehicleType : vehicleTypes_)
+    for (auto const &vehicleType : *vehicleTypes_)
     {
         if (vehicleType.startDepot >= numDepots())
             throw std::out_of_range("Vehicle type has invalid start depot.");
@@ -382,24 +385,24 @@ void ProblemData::validate() const
         if (vehicleType.endDepot >= numDepots())
             throw std::out_of_range("Vehicle type has invalid end depot.");
 
-        if (vehicleType.profile >= dists_.size())
+        if (vehicleType.profile >= numProfiles())
             throw std::out_of_range("Vehicle type has invalid profile.");
     }
 
     // Matrix checks.
-    if (dists_.empty() || durs_.empty())
+    if (dists_->empty() || durs_->empty())
         throw std::invalid_argument("Need at least one distance and duration "
                                     "matrix.");
 
-    if (dists_.size() != durs_.size())
+    if (dists_->size() != durs_->size())
         throw std::invalid_argument("Inconsistent number of distance and "
                                     "duration matrices.");
 
-    for (size_t idx = 0; idx != dists_.size(); ++idx)
+    for (size_t idx = 0; idx != dists_->size(); ++idx)
     {
         auto const numLocs = numLocations();
-        auto const &dist = dists_[idx];
-        auto const &dur = durs_[idx];
+        auto const &dist = (*dists_)[idx];
+        auto const &dur = (*durs_)[idx];
 
         if (dist.numRows() != numLocs || dist.numCols() != numLocs)
             throw std::invalid_argument("Distance matrix shape does not match "
@@ -422,6 +425,26 @@ void ProblemData::validate() const
     }
 }
 
+namespace
+{
+// Moves the given data into a new shared, immutable buffer.
+template <typename T>
+std::shared_ptr<std::vector<T> const> share(std::vector<T> data)
+{
+    return std::make_shared<std::vector<T> const>(std::move(data));
+}
+
+// Returns a new shared buffer holding the given replacement data, if any, or
+// else the existing shared buffer.
+template <typename T>
+std::shared_ptr<std::vector<T> const>
+shareOrReplace(std::optional<std::vector<T>> &replacement,
+               std::shared_ptr<std::vector<T> const> const &existing)
+{
+    return replacement ? share(std::move(*replacement)) : existing;
+}
+}  // namespace
+
 ProblemData
 ProblemData::replace(std::optional<std::vector<Client>> &clients,
                      std::optional<std::vector<Depot>> &depots,
@@ -430,12 +453,12 @@ ProblemData::replace(std::optional<std::vector<Client>> &clients,
                      std::optional<std::vector<Matrix<Duration>>> &durMats,
                      std::optional<std::vector<ClientGroup>> &groups)
 {
-    return ProblemData(clients.value_or(clients_),
-                       depots.value_or(depots_),
-                       vehicleTypes.value_or(vehicleTypes_),
-                       distMats.value_or(dists_),
-                       durMats.value_or(durs_),
-                       groups.value_or(groups_));
+    return ProblemData(shareOrReplace(clients, clients_),
+                       shareOrReplace(depots, depots_),
+                       shareOrReplace(vehicleTypes, vehicleTypes_),
+                       shareOrReplace(distMats, dists_),
+                       shareOrReplace(durMats, durs_),
+                       shareOrReplace(groups, groups_));
 }
 
 ProblemData::ProblemData(std::vector<Client> clients,
@@ -444,6 +467,21 @@ ProblemData::ProblemData(std::vector<Client> clients,
                          std::vector<Matrix<Distance>> distMats,
                          std::vector<Matrix<Duration>> durMats,
                          std::vector<ClientGroup> groups)
+    : ProblemData(share(std::move(clients)),
+                  share(std::move(depots)),
+                  share(std::move(vehicleTypes)),
+                  share(std::move(distMats)),
+                  share(std::move(durMats)),
+                  share(std::move(groups)))
+{
+}
+
+ProblemData::ProblemData(Shared<Client> clients,
+                         Shared<Depot> depots,
+                         Shared<VehicleType> vehicleTypes,
+                         Shared<Matrix<Distance>> distMats,
+                         Shared<Matrix<Duration>> durMats,
+                         Shared<ClientGroup> groups)
     : centroid_({0, 0}),
       dists_(std::move(distMats)),
       durs_(std::move(durMats)),
@@ -451,13 +489,13 @@ ProblemData::ProblemData(std::vector<Client> clients,
       depots_(std::move(depots)),
       vehicleTypes_(std::move(vehicleTypes)),
       groups_(std::move(groups)),
-      numVehicles_(std::accumulate(vehicleTypes_.begin(),
-                                   vehicleTypes_.end(),
+      numVehicles_(std::accumulate(vehicleTypes_->begin(),
+                                   vehicleTypes_->end(),
                                    0,
                                    [](auto sum, VehicleType const &type)
                                    { return sum + type.numAvailable; }))
 {
-    for (auto const &client : clients_)
+    for (auto const &client : *clients_)
     {
         centroid_.first += static_cast<double>(client.x) / numClients();
         centroid_.second += static_cast<double>(client.y) / numClients();
@@ -7,6 +7,7 @@
 #include <cassert>
 #include <iosfwd>
 #include <limits>
+#include <memory>
 #include <optional>
 #include <vector>
 
@@ -441,15 +442,28 @@ private:
         inline operator Depot const &() const;
     };
 
-    std::pair<double, double> centroid_;           // Center of client locations
-    std::vector<Matrix<Distance>> const dists_;    // Distance matrices
-    std::vector<Matrix<Duration>> const durs_;     // Duration matrices
-    std::vector<Client> const clients_;            // Client information
-    std::vector<Depot> const depots_;              // Depot information
-    std::vector<VehicleType> const vehicleTypes_;  // Vehicle type information
-    std::vector<ClientGroup> const groups_;        // Client groups
-
-    size_t const numVehicles_;
+    template <typename T> using Shared = std::shared_ptr<std::vector<T> const>;
+
+    // The data are stored in shared, immutable buffers. Instances created via
+    // replace() share all buffers that are not replaced, so that changing,
+    // for example, the clients does not copy the distance and duration
+    // matrices.
+    std::pair<double, double> centroid_;  // Center of client locations
+    Shared<Matrix<Distance>> dists_;      // Distance matrices
+    Shared<Matrix<Duration>> durs_;       // Duration matrices
+    Shared<Client> clients_;              // Client information
+    Shared<Depot> depots_;                // Depot information
+    Shared<VehicleType> vehicleTypes_;    // Vehicle type information
+    Shared<ClientGroup> groups_;          // Client groups
+
+    size_t numVehicles_;
+
+    ProblemData(Shared<Client> clients,
+                Shared<Depot> depots,
+                Shared<VehicleType> vehicleTypes,
+                Shared<Matrix<Distance>> distMats,
+                Shared<Matrix<Duration>> durMats,
+                Shared<ClientGroup> groups);
 
 public:
     /**
@@ -605,7 +619,10 @@ public:
 
     /**
      * Returns a new ProblemData instance with the same data as this instance,
-     * except for the given parameters, which are used instead.
+     * except for the given parameters, which are used instead. Data that are
+     * not replaced are shared with this instance rather than copied, so that,
+     * for example, replacing only the clients does not copy the distance and
+     * duration matrices.
      *
      * Parameters
      * ----------
@@ -651,21 +668,21 @@ ProblemData::Location::operator Depot const &() const { return *depot; }
 ProblemData::Location ProblemData::location(size_t idx) const
 {
     assert(idx < numLocations());
-    return idx < depots_.size()
-               ? Location{.depot = &depots_[idx]}
-               : Location{.client = &clients_[idx - depots_.size()]};
+    return idx < depots_->size()
+               ? Location{.depot = &(*depots_)[idx]}
+               : Location{.client = &(*clients_)[idx - depots_->size()]};
 }
 
 Matrix<Distance> const &ProblemData::distanceMatrix(size_t profile) const
 {
-    assert(profile < dists_.size());
-    return dists_[profile];
+    assert(profile < dists_->size());
+    return (*dists_)[profile];
 }
 
 Matrix<Duration> const &ProblemData::durationMatrix(size_t profile) const
 {
-    assert(profile < durs_.size());
-    return durs_[profile];
+    assert(profile < durs_->size());
+    return (*durs_)[profile];
 }
 }  // namespace pyvrp
 
@@ -15,7 +15,9 @@ using pyvrp::Route;
 using Client = size_t;
 
 Route::Route(ProblemData const &data, Visits visits, size_t const vehicleType)
-    : visits_(std::move(visits)), centroid_({0, 0}), vehicleType_(vehicleType)
+    : visits_(std::make_shared<Visits const>(std::move(visits))),
+      centroid_({0, 0}),
+      vehicleType_(vehicleType)
 {
     auto const &vehType = data.vehicleType(vehicleType);
     startDepot_ = vehType.startDepot;
@@ -30,7 +32,7 @@ Route::Route(ProblemData const &data, Visits visits, size_t const vehicleType)
 
     for (size_t idx = 0; idx != size(); ++idx)
     {
-        auto const client = visits_[idx];
+        auto const client = (*visits_)[idx];
         ProblemData::Client const &clientData = data.location(client);
 
         distance_ += distances(prevClient, client);
@@ -50,7 +52,7 @@ Route::Route(ProblemData const &data, Visits visits, size_t const vehicleType)
         prevClient = client;
     }
 
-    auto const last = visits_.empty() ? startDepot_ : visits_.back();
+    auto const last = empty() ? startDepot_ : visits_->back();
     distance_ += distances(last, endDepot_);
     distanceCost_ = vehType.unitDistanceCost * static_cast<Cost>(distance_);
     excessDistance_ = std::max<Distance>(distance_ - vehType.maxDistance, 0);
@@ -92,7 +94,7 @@ Route::Route(Visits visits,
              size_t vehicleType,
              size_t startDepot,
              size_t endDepot)
-    : visits_(std::move(visits)),
+    : visits_(std::make_shared<Visits const>(std::move(visits))),
       distance_(distance),
       distanceCost_(distanceCost),
       excessDistance_(excessDistance),
@@ -116,17 +118,20 @@ Route::Route(Visits visits,
 {
 }
 
-bool Route::empty() const { return visits_.empty(); }
+bool Route::empty() const { return visits_->empty(); }
 
-size_t Route::size() const { return visits_.size(); }
+size_t Route::size() const { return visits_->size(); }
 
-Client Route::operator[](size_t idx) const { return visits_[idx]; }
+Client Route::operator[](size_t idx) const { return (*visits_)[idx]; }
 
-Route::Visits::const_iterator Route::begin() const { return visits_.cbegin(); }
+Route::Visits::const_iterator Route::begin() const
+{
+    return visits_->cbegin();
+}
 
-Route::Visits::const_iterator Route::end() const { return visits_.cend(); }
+Route::Visits::const_iterator Route::end() const { return visits_->cend(); }
 
-Route::Visits const &Route::visits() const { return visits_; }
+Route::Visits const &Route::visits() const { return *visits_; }
 
 Distance Route::distance() const { return distance_; }
 
@@ -191,7 +196,7 @@ bool Route::operator==(Route const &other) const
         && pickup_ == other.pickup_
         && timeWarp_ == other.timeWarp_
         && vehicleType_ == other.vehicleType_
-        && visits_ == other.visits_;
+        && (visits_ == other.visits_ || *visits_ == *other.visits_);
     // clang-format on
 }
 
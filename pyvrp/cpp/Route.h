@@ -5,7 +5,9 @@
 #include "ProblemData.h"
 #include "RandomNumberGenerator.h"
 
+#include <functional>
 #include <iosfwd>
+#include <memory>
 #include <optional>
 #include <vector>
 
@@ -23,7 +25,11 @@ class Route
     using VehicleType = size_t;
     using Visits = std::vector<Client>;
 
-    Visits visits_ = {};           // Client visits on this route
+    // Client visits on this route. The visits are immutable once the route
+    // is constructed, so copies of this route share the same buffer. That
+    // makes copying routes (and thus solutions) cheap.
+    std::shared_ptr<Visits const> visits_;
+
     Distance distance_ = 0;        // Total travel distance on this route
     Cost distanceCost_ = 0;        // Total cost of travel distance
     Distance excessDistance_ = 0;  // Excess travel distance
@@ -245,4 +251,17 @@ public:
 
 std::ostream &operator<<(std::ostream &out, pyvrp::Route const &route);
 
+template <> struct std::hash<pyvrp::Route>
+{
+    size_t operator()(pyvrp::Route const &route) const
+    {
+        size_t res = std::hash<size_t>()(route.vehicleType());
+        for (auto const client : route)  // hash_combine-style mixing
+            res ^= std::hash<size_t>()(client) + 0x9e3779b9 + (res << 6)
+                   + (res >> 2);
+
+        return res;
+    }
+};
+
 #endif  // PYVRP_ROUTE_H
@@ -0,0 +1,36 @@
+#include "RouteGeometry.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+double pyvrp::routeAngle(ProblemData const &data, Route const &route)
+{
+    auto const [dataX, dataY] = data.centroid();
+    auto const [routeX, routeY] = route.centroid();
+    return std::atan2(routeY - dataY, routeX - dataX);
+}
+
+std::vector<size_t> pyvrp::giantTour(ProblemData const &data,
+                                     std::vector<Route> const &routes)
+{
+    std::vector<double> angles;
+    angles.reserve(routes.size());
+    for (auto const &route : routes)
+        angles.push_back(routeAngle(data, route));
+
+    std::vector<size_t> order(routes.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(),
+              order.end(),
+              [&](auto lhs, auto rhs) { return angles[lhs] < angles[rhs]; });
+
+    std::vector<size_t> tour;
+    for (auto const idx : order)
+    {
+        auto const &visits = routes[idx].visits();
+        tour.insert(tour.end(), visits.begin(), visits.end());
+    }
+
+    return tour;
+}
@@ -0,0 +1,24 @@
+#ifndef PYVRP_ROUTEGEOMETRY_H
+#define PYVRP_ROUTEGEOMETRY_H
+
+#include "ProblemData.h"
+#include "Route.h"
+
+#include <vector>
+
+// Helpers that order routes by their position around the centroid of all
+// client locations. These are used by the crossover and construction
+// heuristics that work with giant tours.
+namespace pyvrp
+{
+// Polar angle of the given route's centroid with respect to the centroid of
+// all client locations.
+double routeAngle(ProblemData const &data, Route const &route);
+
+// Giant tour of the given routes: the concatenation of their visits, in order
+// of ascending route angle.
+std::vector<size_t> giantTour(ProblemData const &data,
+                              std::vector<Route> const &routes);
+}  // namespace pyvrp
+
+#endif  // PYVRP_ROUTEGEOMETRY_H
@@ -0,0 +1,233 @@
+#include "RoutePool.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+using pyvrp::Cost;
+using pyvrp::RoutePool;
+using pyvrp::Solution;
+
+namespace
+{
+size_t constexpr NONE = std::numeric_limits<size_t>::max();
+}  // namespace
+
+RoutePool::RoutePool(ProblemData const &data, size_t maxSize)
+    : data_(data), maxSize_(maxSize)
+{
+    if (maxSize == 0)
+        throw std::invalid_argument("Expected max_size > 0.");
+}
+
+void RoutePool::shrink()
+{
+    if (entries_.size() <= maxSize_)
+        return;
+
+    // Move the most recently seen routes to the front, and drop the rest.
+    auto const nth = entries_.begin() + maxSize_;
+    std::nth_element(entries_.begin(),
+                     nth,
+                     entries_.end(),
+                     [](auto const &lhs, auto const &rhs)
+                     { return lhs.lastSeen > rhs.lastSeen; });
+    entries_.erase(nth, entries_.end());
+
+    index_.clear();
+    for (size_t idx = 0; idx != entries_.size(); ++idx)
+        index_[std::hash<Route>()(entries_[idx].route)] = idx;
+}
+
+void RoutePool::add(Solution const &solution)
+{
+    counter_++;
+
+    for (auto const &route : solution.routes())
+    {
+        if (route.empty() || !route.isFeasible())
+            continue;
+
+        auto const hash = std::hash<Route>()(route);
+        auto const [it, inserted] = index_.try_emplace(hash, entries_.size());
+
+        if (inserted)
+            entries_.push_back({route, counter_});
+        else if (entries_[it->second].route.visits() == route.visits())
+            entries_[it->second].lastSeen = counter_;
+
+        // Else there's a hash collision with a different route. That's rare
+        // enough that we simply do not add the new route in that case.
+    }
+
+    shrink();
+}
+
+Solution RoutePool::combine() const
+{
+    // Cost of leaving each client unassigned. For required clients this is
+    // the cost of serving the client on a dedicated route, which is an upper
+    // bound on what a subsequent search needs to serve it. Optional clients
+    // can be left out at no cost, since their prizes are accounted for in the
+    // route values below.
+    std::vector<Cost> missing(data_.numLocations(), 0);
+    for (size_t client = data_.numDepots(); client != missing.size(); ++client)
+    {
+        ProblemData::Client const &clientData = data_.location(client);
+        if (!clientData.required)
+            continue;
+
+        auto cost = std::numeric_limits<Cost>::max();
+        for (auto const &vehType : data_.vehicleTypes())
+        {
+            auto const &distances = data_.distanceMatrix(vehType.profile);
+            auto const &durations = data_.durationMatrix(vehType.profile);
+
+            auto const dist = distances(vehType.startDepot, client)
+                              + distances(client, vehType.endDepot);
+            auto const dur = durations(vehType.startDepot, client)
+                             + clientData.serviceDuration
+                             + durations(client, vehType.endDepot);
+
+            cost = std::min(cost,
+                            vehType.fixedCost
+                                + vehType.unitDistanceCost
+                                      * static_cast<Cost>(dist)
+                                + vehType.unitDurationCost
+                                      * static_cast<Cost>(dur));
+        }
+
+        missing[client] = cost;
+    }
+
+    // The value of selecting a route is the change in objective compared to
+    // leaving all its clients unassigned. Negative values are improving.
+    std::vector<Cost> values;
+    values.reserve(entries_.size());
+    for (auto const &[route, _] : entries_)
+    {
+        auto const &vehType = data_.vehicleType(route.vehicleType());
+        Cost value = vehType.fixedCost + route.distanceCost()
+                     + route.durationCost() - route.prizes();
+
+        for (auto const client : route)
+            value -= missing[client];
+
+        values.push_back(value);
+    }
+
+    // Greedy construction: consider routes by increasing value per client,
+    // and select each route that does not conflict with earlier selections.
+    std::vector<double> perClient;
+    perClient.reserve(entries_.size());
+    for (size_t idx = 0; idx != entries_.size(); ++idx)
+        perClient.push_back(static_cast<double>(values[idx])
+                            / entries_[idx].route.size());
+
+    std::vector<size_t> order(entries_.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(),
+                     order.end(),
+                     [&](auto const lhs, auto const rhs)
+                     { return perClient[lhs] < perClient[rhs]; });
+
+    std::vector<size_t> coveredBy(data_.numLocations(), NONE);
+    std::vector<size_t> numUsed(data_.numVehicleTypes(), 0);
+    std::vector<bool> selected(entries_.size(), false);
+
+    auto const select = [&](size_t idx)
+    {
+        auto const &route = entries_[idx].route;
+        for (auto const client : route)
+            coveredBy[client] = idx;
+
+        numUsed[route.vehicleType()]++;
+        selected[idx] = true;
+    };
+
+    auto const deselect = [&](size_t idx)
+    {
+        auto const &route = entries_[idx].route;
+        for (auto const client : route)
+            coveredBy[client] = NONE;
+
+        numUsed[route.vehicleType()]--;
+        selected[idx] = false;
+    };
+
+    for (auto const idx : order)
+    {
+        auto const &route = entries_[idx].route;
+        auto const vehType = route.vehicleType();
+
+        if (values[idx] >= 0
+            || numUsed[vehType] == data_.vehicleType(vehType).numAvailable)
+            continue;
+
+        if (std::all_of(route.begin(),
+                        route.end(),
+                        [&](auto client) { return coveredBy[client] == NONE; }))
+            select(idx);
+    }
+
+    // Improvement: swap an unselected route in for the selected routes it
+    // conflicts with, as long as that strictly improves the objective.
+    std::vector<size_t> conflicts;
+    for (bool improved = true; improved;)
+    {
+        improved = false;
+
+        for (auto const idx : order)
+        {
+            if (selected[idx] || values[idx] >= 0)
+                continue;
+
+            auto const &route = entries_[idx].route;
+            conflicts.clear();
+            for (auto const client : route)
+                if (coveredBy[client] != NONE
+                    && std::find(conflicts.begin(),
+                                 conflicts.end(),
+                                 coveredBy[client])
+                           == conflicts.end())
+                    conflicts.push_back(coveredBy[client]);
+
+            auto delta = values[idx];
+            auto numUsedAfter = numUsed[route.vehicleType()] + 1;
+            for (auto const other : conflicts)
+            {
+                delta -= values[other];
+                if (entries_[other].route.vehicleType() == route.vehicleType())
+                    numUsedAfter--;
+            }
+
+            auto const &vehType = data_.vehicleType(route.vehicleType());
+            if (delta >= 0 || numUsedAfter > vehType.numAvailable)
+                continue;
+
+            for (auto const other : conflicts)
+                deselect(other);
+
+            select(idx);
+            improved = true;
+        }
+    }
+
+    std::vector<Route> routes;
+    for (size_t idx = 0; idx != entries_.size(); ++idx)
+        if (selected[idx])
+            routes.push_back(entries_[idx].route);
+
+    return {data_, routes};
+}
+
+void RoutePool::clear()
+{
+    entries_.clear();
+    index_.clear();
+}
+
+size_t RoutePool::size() const { return entries_.size(); }
+
+size_t RoutePool::maxSize() const { return maxSize_; }
@@ -0,0 +1,98 @@
+#ifndef PYVRP_ROUTEPOOL_H
+#define PYVRP_ROUTEPOOL_H
+
+#include "Measure.h"
+#include "ProblemData.h"
+#include "Route.h"
+#include "Solution.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace pyvrp
+{
+/**
+ * RoutePool(data: ProblemData, max_size: int = 1_000)
+ *
+ * A pool of distinct, feasible routes collected from good solutions. The pool
+ * can be recombined into a new solution by solving a set-partitioning problem
+ * over its routes, using a lightweight heuristic: a greedy construction
+ * followed by swap improvements.
+ *
+ * Parameters
+ * ----------
+ * data
+ *     Data instance.
+ * max_size
+ *     Maximum number of routes to keep in the pool. When the pool grows beyond
+ *     this size, the routes that were least recently seen are removed.
+ *
+ * Raises
+ * ------
+ * ValueError
+ *     When ``max_size`` is zero.
+ */
+class RoutePool
+{
+    struct Entry
+    {
+        Route route;
+        size_t lastSeen;  // counter value when the route was last added
+    };
+
+    ProblemData const &data_;
+    size_t const maxSize_;
+
+    std::vector<Entry> entries_;
+    std::unordered_map<size_t, size_t> index_;  // route hash -> entry index
+    size_t counter_ = 0;
+
+    // Removes the least recently seen routes until at most maxSize_ remain.
+    void shrink();
+
+public:
+    RoutePool(ProblemData const &data, size_t maxSize = 1'000);
+
+    /**
+     * Adds the feasible routes of the given solution to the pool. Routes that
+     * are already in the pool are not added again, but do count as recently
+     * seen. Empty routes are never added.
+     *
+     * Parameters
+     * ----------
+     * solution
+     *     Solution whose routes to add.
+     */
+    void add(Solution const &solution);
+
+    /**
+     * Combines routes from the pool into a new solution. The selected routes
+     * are client-disjoint and respect the number of available vehicles of each
+     * type. Required clients that cannot be covered by the selected routes are
+     * left unassigned, for a subsequent search to insert.
+     *
+     * Returns
+     * -------
+     * Solution
+     *     The combined solution. This solution may be incomplete.
+     */
+    Solution combine() const;
+
+    /**
+     * Removes all routes from the pool.
+     */
+    void clear();
+
+    /**
+     * Returns the number of routes currently in the pool.
+     */
+    [[nodiscard]] size_t size() const;
+
+    /**
+     * Returns the maximum number of routes kept in the pool.
+     */
+    [[nodiscard]] size_t maxSize() const;
+};
+}  // namespace pyvrp
+
+#endif  // PYVRP_ROUTEPOOL_H
@@ -3,6 +3,7 @@
 #include "LoadSegment.h"
 
 #include <algorithm>
+#include <cstdint>
 #include <fstream>
 #include <numeric>
 #include <unordered_map>
@@ -18,6 +19,18 @@ using Client = size_t;
 using Routes = std::vector<Route>;
 using Neighbours = std::vector<std::optional<std::pair<Client, Client>>>;
 
+namespace
+{
+// SplitMix64 finaliser. See https://prng.di.unimi.it/splitmix64.c.
+size_t mix(size_t value)
+{
+    uint64_t z = value + 0x9e3779b97f4a7c15;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+    return z ^ (z >> 31);
+}
+}  // namespace
+
 void Solution::evaluate(ProblemData const &data)
 {
     Cost allPrizes = 0;
@@ -54,6 +67,12 @@ Routes const &Solution::routes() const { return routes_; }
 
 Neighbours const &Solution::neighbours() const { return neighbours_; }
 
+size_t Solution::hash() const { return hash_; }
+
+std::vector<uint32_t> const &Solution::predecessors() const { return preds_; }
+
+std::vector<uint32_t> const &Solution::successors() const { return succs_; }
+
 bool Solution::isFeasible() const
 {
     // clang-format off
@@ -108,12 +127,44 @@ void Solution::makeNeighbours(ProblemData const &data)
                 idx == 0 ? startDepot : route[idx - 1],                // pred
                 idx == route.size() - 1 ? endDepot : route[idx + 1]};  // succ
     }
+
+    makeHash();
+    makeFlatNeighbours();
+}
+
+void Solution::makeHash()
+{
+    // Each (client, pred, succ) triple acts as a key into an implicit table of
+    // random values, which are XOR-ed together. That makes the hash invariant
+    // to the order of the routes.
+    hash_ = 0;
+    for (size_t client = 0; client != neighbours_.size(); ++client)
+        if (neighbours_[client])
+        {
+            auto const [pred, succ] = neighbours_[client].value();
+            hash_ ^= mix(mix(mix(client) ^ pred) ^ succ);
+        }
+}
+
+void Solution::makeFlatNeighbours()
+{
+    preds_.assign(neighbours_.size(), UNASSIGNED);
+    succs_.assign(neighbours_.size(), UNASSIGNED);
+
+    for (size_t client = 0; client != neighbours_.size(); ++client)
+        if (neighbours_[client])
+        {
+            auto const [pred, succ] = neighbours_[client].value();
+            preds_[client] = static_cast<uint32_t>(pred);
+            succs_[client] = static_cast<uint32_t>(succ);
+        }
 }
 
 bool Solution::operator==(Solution const &other) const
 {
     // clang-format off
-    bool const attributeChecks = distance_ == other.distance_
+    bool const attributeChecks = hash_ == other.hash_
+                              && distance_ == other.distance_
                               && duration_ == other.duration_
                               && distanceCost_ == other.distanceCost_
                               && durationCost_ == other.durationCost_
@@ -297,6 +348,8 @@ Solution::Solution(size_t numClients,
       routes_(routes),
       neighbours_(neighbours)
 {
+    makeHash();
+    makeFlatNeighbours();
 }
 
 std::ostream &operator<<(std::ostream &out, Solution const &sol)
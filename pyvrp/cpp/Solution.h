@@ -6,8 +6,10 @@
 #include "RandomNumberGenerator.h"
 #include "Route.h"
 
+#include <cstdint>
 #include <functional>
 #include <iosfwd>
+#include <limits>
 #include <optional>
 #include <vector>
 
@@ -61,10 +63,24 @@ class Solution
 
     Routes routes_;
     Neighbours neighbours_;  // client [pred, succ] pairs, null if unassigned
+    size_t hash_ = 0;        // hash of the [pred, succ] pairs
+
+    // Flat copies of the [pred, succ] pairs, with UNASSIGNED for locations
+    // that are not in the solution (or are depots). These are more compact
+    // than the neighbours, and are what the diversity measures compare.
+    std::vector<uint32_t> preds_;
+    std::vector<uint32_t> succs_;
 
     // Determines the [pred, succ] pairs for assigned clients.
     void makeNeighbours(ProblemData const &data);
 
+    // Computes a Zobrist-style hash of the [pred, succ] pairs: the XOR of a
+    // hash of each assigned client's (client, pred, succ) triple.
+    void makeHash();
+
+    // Determines the flat predecessor and successor arrays.
+    void makeFlatNeighbours();
+
     // Evaluates this solution's characteristics.
     void evaluate(ProblemData const &data);
 
@@ -74,6 +90,9 @@ class Solution
     Solution &operator=(Solution &&other) = default;
 
 public:
+    // Value of the flat predecessors and successors for unassigned locations.
+    static uint32_t constexpr UNASSIGNED = std::numeric_limits<uint32_t>::max();
+
     // Solution is empty when it has no routes and no clients.
     [[nodiscard]] bool empty() const;
 
@@ -122,6 +141,18 @@ public:
      */
     [[nodiscard]] Neighbours const &neighbours() const;
 
+    // Hash of this solution's neighbour structure. Solutions that compare
+    // equal have the same hash.
+    [[nodiscard]] size_t hash() const;
+
+    // Predecessor of each location, or UNASSIGNED if the location is not in
+    // the solution (or is a depot).
+    [[nodiscard]] std::vector<uint32_t> const &predecessors() const;
+
+    // Successor of each location, or UNASSIGNED if the location is not in the
+    // solution (or is a depot).
+    [[nodiscard]] std::vector<uint32_t> const &successors() const;
+
     /**
      * Whether this solution is feasible.
      */
@@ -270,13 +301,7 @@ template <> struct std::hash<pyvrp::Solution>
 {
     size_t operator()(pyvrp::Solution const &sol) const
     {
-        size_t res = 17;
-        res = res * 31 + std::hash<size_t>()(sol.numRoutes());
-        res = res * 31 + std::hash<pyvrp::Distance>()(sol.distance());
-        res = res * 31 + std::hash<pyvrp::Load>()(sol.excessLoad());
-        res = res * 31 + std::hash<pyvrp::Duration>()(sol.timeWarp());
-
-        return res;
+        return sol.hash();
     }
 };
 
@@ -0,0 +1,446 @@
+#include "Split.h"
+
+#include "DurationSegment.h"
+#include "LoadSegment.h"
+#include "Matrix.h"
+
+#include <algorithm>
+#include <deque>
+#include <limits>
+#include <stdexcept>
+
+using pyvrp::Cost;
+using pyvrp::CostEvaluator;
+using pyvrp::Distance;
+using pyvrp::Duration;
+using pyvrp::DurationSegment;
+using pyvrp::Load;
+using pyvrp::LoadSegment;
+using pyvrp::Matrix;
+using pyvrp::ProblemData;
+using pyvrp::Route;
+
+namespace
+{
+// Route visiting a contiguous part of the giant tour, to which clients can be
+// appended one at a time. The route's penalised cost is evaluated in constant
+// time after each such append.
+class PartialRoute
+{
+    ProblemData const &data_;
+    ProblemData::VehicleType const &vehType_;
+
+    size_t last_;
+    Distance distance_ = 0;
+    DurationSegment ds_;
+    LoadSegment ls_ = {0, 0, 0};
+
+public:
+    PartialRoute(ProblemData const &data, size_t vehicleType)
+        : data_(data),
+          vehType_(data.vehicleType(vehicleType)),
+          last_(vehType_.startDepot),
+          ds_(vehType_.startDepot, vehType_)
+    {
+    }
+
+    void push_back(size_t client)
+    {
+        ProblemData::Client const &clientData = data_.location(client);
+        auto const &distances = data_.distanceMatrix(vehType_.profile);
+        auto const &durations = data_.durationMatrix(vehType_.profile);
+
+        distance_ += distances(last_, client);
+        ds_ = DurationSegment::merge(
+            durations, ds_, DurationSegment(client, clientData));
+        ls_ = LoadSegment::merge(ls_, LoadSegment(clientData));
+        last_ = client;
+    }
+
+    [[nodiscard]] Load load() const { return ls_.load(); }
+
+    // Penalised cost of this route when it returns to the end depot after the
+    // last appended client. Prizes are not included.
+    [[nodiscard]] Cost cost(CostEvaluator const &costEvaluator) const
+    {
+        auto const &distances = data_.distanceMatrix(vehType_.profile);
+        auto const &durations = data_.durationMatrix(vehType_.profile);
+
+        auto const dist = distance_ + distances(last_, vehType_.endDepot);
+        auto const ds = DurationSegment::merge(
+            durations, ds_, DurationSegment(vehType_.endDepot, vehType_));
+
+        return vehType_.fixedCost
+               + vehType_.unitDistanceCost * static_cast<Cost>(dist)
+               + vehType_.unitDurationCost * static_cast<Cost>(ds.duration())
+               + costEvaluator.loadPenalty(ls_.load(), vehType_.capacity)
+               + costEvaluator.twPenalty(ds.timeWarp(vehType_.maxDuration))
+               + costEvaluator.distPenalty(dist, vehType_.maxDistance);
+    }
+};
+// Creates the routes of a split, given the start of the route ending at each
+// position in the tour, and that route's vehicle type.
+std::vector<Route> makeRoutes(ProblemData const &data,
+                              std::vector<size_t> const &tour,
+                              std::vector<size_t> const &preds,
+                              std::vector<size_t> const &types)
+{
+    std::vector<Route> routes;
+    for (auto end = tour.size(); end != 0; end = preds[end])
+    {
+        auto const start = preds[end];
+        std::vector<size_t> visits = {tour.begin() + start, tour.begin() + end};
+        routes.emplace_back(data, std::move(visits), types[end]);
+    }
+
+    std::reverse(routes.begin(), routes.end());
+    return routes;
+}
+
+// Whether routes serving parts of the given tour are only constrained by their
+// vehicle's capacity, and their cost is otherwise additive in the edges they
+// use. Then the linear split below applies.
+bool isCapacityOnly(ProblemData const &data, std::vector<size_t> const &tour)
+{
+    if (data.numVehicleTypes() != 1)
+        return false;
+
+    auto const &vehType = data.vehicleType(0);
+    if (vehType.unitDurationCost != 0
+        || vehType.twLate != std::numeric_limits<Duration>::max()
+        || vehType.maxDuration != std::numeric_limits<Duration>::max()
+        || vehType.maxDistance != std::numeric_limits<Distance>::max())
+        return false;
+
+    // The route's load is the sum of the client loads only when the route does
+    // not mix deliveries and pickups.
+    bool hasDelivery = false;
+    bool hasPickup = false;
+    for (auto const client : tour)
+    {
+        ProblemData::Client const &clientData = data.location(client);
+        if (clientData.twLate != std::numeric_limits<Duration>::max())
+            return false;
+
+        hasDelivery |= clientData.delivery > 0;
+        hasPickup |= clientData.pickup > 0;
+    }
+
+    return !hasDelivery || !hasPickup;
+}
+
+// Split in linear time for capacity-only instances, using the deque-based
+// algorithm of Vidal (2016). Positions that are dominated as predecessors of
+// all later positions are removed from the deque, so each position is pushed
+// and popped at most once. When that split uses more vehicles than available,
+// the tour is split again with one such pass per vehicle, which takes time
+// linear in the tour length times the number of vehicles.
+std::vector<Route> linearSplit(ProblemData const &data,
+                               std::vector<size_t> const &tour,
+                               CostEvaluator const &costEvaluator)
+{
+    auto const numClients = tour.size();
+    auto const &vehType = data.vehicleType(0);
+    auto const &distances = data.distanceMatrix(vehType.profile);
+
+    // Costs along the tour. Position pos = 1, ..., numClients refers to the
+    // client tour[pos - 1]. The cost of travelling along the tour from the
+    // first position to pos is given by sumDist[pos].
+    std::vector<Cost> sumDist(numClients + 1, 0);
+    std::vector<Cost> fromStart(numClients + 1, 0);
+    std::vector<Cost> toEnd(numClients + 1, 0);
+    std::vector<Load> sumLoad(numClients + 1, 0);
+
+    for (size_t pos = 1; pos <= numClients; ++pos)
+    {
+        auto const client = tour[pos - 1];
+        ProblemData::Client const &clientData = data.location(client);
+
+        auto const unitCost = vehType.unitDistanceCost;
+        auto const start = distances(vehType.startDepot, client);
+        auto const end = distances(client, vehType.endDepot);
+        fromStart[pos] = unitCost * static_cast<Cost>(start);
+        toEnd[pos] = unitCost * static_cast<Cost>(end);
+
+        if (pos > 1)
+        {
+            auto const dist = distances(tour[pos - 2], client);
+            auto const cost = unitCost * static_cast<Cost>(dist);
+            sumDist[pos] = sumDist[pos - 1] + cost;
+        }
+
+        auto const load = clientData.delivery + clientData.pickup;
+        sumLoad[pos] = sumLoad[pos - 1] + load;
+    }
+
+    // Cost of a split of the first `to` clients, where the last route serves
+    // the clients after position `from`.
+    auto const propagate = [&](std::vector<Cost> const &costs,
+                               size_t from,
+                               size_t to)
+    {
+        auto const load = sumLoad[to] - sumLoad[from];
+        return costs[from] + vehType.fixedCost + fromStart[from + 1]
+               + sumDist[to] - sumDist[from + 1] + toEnd[to]
+               + costEvaluator.loadPenalty(load, vehType.capacity);
+    };
+
+    // Whether predecessor lhs < rhs is better than rhs for all later positions.
+    auto const dominates = [&](std::vector<Cost> const &costs,
+                               size_t lhs,
+                               size_t rhs)
+    {
+        auto const load = sumLoad[rhs] - sumLoad[lhs];
+        return costs[rhs] + fromStart[rhs + 1]
+               > costs[lhs] + fromStart[lhs + 1] + sumDist[rhs + 1]
+                     - sumDist[lhs + 1] + costEvaluator.loadPenalty(load, 0);
+    };
+
+    // Whether predecessor rhs > lhs is no worse than lhs for all later
+    // positions.
+    auto const dominatesRight = [&](std::vector<Cost> const &costs,
+                                    size_t lhs,
+                                    size_t rhs)
+    {
+        return costs[rhs] + fromStart[rhs + 1]
+               <= costs[lhs] + fromStart[lhs + 1] + sumDist[rhs + 1]
+                      - sumDist[lhs + 1];
+    };
+
+    // Computes next[to] for all positions after first, as the best cost of
+    // extending any of the splits in prev by one route. Both may refer to the
+    // same costs, in which case there is no limit on the number of routes.
+    auto const INF = std::numeric_limits<Cost>::max();
+    auto const pass = [&](std::vector<Cost> const &prev,
+                          std::vector<Cost> &next,
+                          std::vector<size_t> &preds,
+                          size_t first)
+    {
+        std::deque<size_t> queue = {first};
+        for (auto to = first + 1; to <= numClients; ++to)
+        {
+            next[to] = propagate(prev, queue.front(), to);
+            preds[to] = queue.front();
+
+            if (to == numClients)
+                break;
+
+            if (prev[to] != INF && !dominates(prev, queue.back(), to))
+            {
+                while (!queue.empty() && dominatesRight(prev, queue.back(), to))
+                    queue.pop_back();
+
+                queue.push_back(to);
+            }
+
+            while (queue.size() > 1
+                   && propagate(prev, queue[0], to + 1)
+                          >= propagate(prev, queue[1], to + 1))
+                queue.pop_front();
+        }
+    };
+
+    std::vector<Cost> costs(numClients + 1, INF);
+    std::vector<size_t> preds(numClients + 1, 0);
+    std::vector<size_t> const types(numClients + 1, 0);
+    costs[0] = 0;
+    pass(costs, costs, preds, 0);
+
+    size_t numRoutes = 0;
+    for (auto end = numClients; end != 0; end = preds[end])
+        numRoutes++;
+
+    if (numRoutes <= vehType.numAvailable)
+        return makeRoutes(data, tour, preds, types);
+
+    // Bounded split: costs[k][to] is the cost of the best split of the first
+    // to clients into exactly k routes.
+    auto const maxRoutes = std::min(vehType.numAvailable, numClients);
+    std::vector<std::vector<Cost>> boundedCosts(
+        maxRoutes + 1, std::vector<Cost>(numClients + 1, INF));
+    std::vector<std::vector<size_t>> boundedPreds(
+        maxRoutes + 1, std::vector<size_t>(numClients + 1, 0));
+    boundedCosts[0][0] = 0;
+
+    for (size_t k = 0; k != maxRoutes; ++k)
+        pass(boundedCosts[k], boundedCosts[k + 1], boundedPreds[k + 1], k);
+
+    // Best number of routes, preferring fewer routes in case of ties.
+    size_t best = 1;
+    for (size_t k = 2; k <= maxRoutes; ++k)
+        if (boundedCosts[k][numClients] < boundedCosts[best][numClients])
+            best = k;
+
+    auto end = numClients;
+    for (auto k = best; k != 0; --k)
+    {
+        preds[end] = boundedPreds[k][end];
+        end = preds[end];
+    }
+
+    return makeRoutes(data, tour, preds, types);
+}
+
+// Split for general instances. This evaluates every route of up to roughly
+// twice the vehicle capacity, for every vehicle type.
+std::vector<Route> bellmanSplit(ProblemData const &data,
+                                std::vector<size_t> const &tour,
+                                CostEvaluator const &costEvaluator)
+{
+    auto const numClients = tour.size();
+
+    // Vehicle slots: each vehicle type repeated as often as it is available,
+    // but never more often than there are clients to serve.
+    std::vector<size_t> slots;
+    for (size_t type = 0; type != data.numVehicleTypes(); ++type)
+    {
+        auto const &vehType = data.vehicleType(type);
+        slots.insert(slots.end(),
+                     std::min(vehType.numAvailable, numClients),
+                     type);
+    }
+
+    // Routes are not extended beyond twice their vehicle's capacity. That
+    // bound is relaxed when there are so few vehicles that routes need to
+    // carry more than that on average, since otherwise the bounded split
+    // below might not be able to serve all clients.
+    Load totalLoad = 0;
+    Load maxLoad = 0;
+    for (auto const client : tour)
+    {
+        ProblemData::Client const &clientData = data.location(client);
+        totalLoad += clientData.delivery + clientData.pickup;
+        maxLoad = std::max(maxLoad, clientData.delivery + clientData.pickup);
+    }
+
+    auto const numSlots = static_cast<Load>(slots.size());
+    std::vector<Load> loadBound;
+    loadBound.reserve(data.numVehicleTypes());
+    for (auto const &vehType : data.vehicleTypes())
+        loadBound.push_back(std::max(vehType.capacity + vehType.capacity,
+                                     totalLoad / numSlots + maxLoad));
+
+    auto const INF = std::numeric_limits<Cost>::max();
+
+    // Unbounded split: costs[end] is the cost of the best split of the first
+    // end clients of the tour, where each route may use any vehicle type.
+    std::vector<Cost> costs(numClients + 1, INF);
+    std::vector<size_t> preds(numClients + 1, 0);
+    std::vector<size_t> types(numClients + 1, 0);
+    costs[0] = 0;
+
+    for (size_t start = 0; start != numClients; ++start)
+        for (size_t type = 0; type != data.numVehicleTypes(); ++type)
+        {
+            PartialRoute route(data, type);
+            for (size_t end = start; end != numClients; ++end)
+            {
+                route.push_back(tour[end]);
+
+                auto const cost = costs[start] + route.cost(costEvaluator);
+                if (cost < costs[end + 1])
+                {
+                    costs[end + 1] = cost;
+                    preds[end + 1] = start;
+                    types[end + 1] = type;
+                }
+
+                if (route.load() > loadBound[type])
+                    break;
+            }
+        }
+
+    std::vector<size_t> numUsed(data.numVehicleTypes(), 0);
+    for (auto end = numClients; end != 0; end = preds[end])
+        numUsed[types[end]]++;
+
+    bool isFleetRespected = true;
+    for (size_t type = 0; type != data.numVehicleTypes(); ++type)
+        if (numUsed[type] > data.vehicleType(type).numAvailable)
+            isFleetRespected = false;
+
+    if (isFleetRespected)
+        return makeRoutes(data, tour, preds, types);
+
+    // Bounded split over the vehicle slots: after processing a slot, costs[end]
+    // is the cost of the best split of the first end clients using only the
+    // slots processed so far. Each slot serves a (possibly empty) contiguous
+    // part of the tour directly after the part served by the previous slot.
+    // This needs a matrix of predecessors, one row per slot.
+    std::fill(costs.begin() + 1, costs.end(), INF);
+    Matrix<size_t> slotPreds(slots.size(), numClients + 1);
+    std::vector<Cost> next(numClients + 1);
+
+    for (size_t slot = 0; slot != slots.size(); ++slot)
+    {
+        auto const type = slots[slot];
+
+        // Skipping the slot leaves the costs unchanged.
+        std::copy(costs.begin(), costs.end(), next.begin());
+        for (size_t end = 0; end <= numClients; ++end)
+            slotPreds(slot, end) = end;
+
+        for (size_t start = 0; start != numClients; ++start)
+        {
+            if (costs[start] == INF)
+                continue;
+
+            PartialRoute route(data, type);
+            for (size_t end = start; end != numClients; ++end)
+            {
+                route.push_back(tour[end]);
+
+                auto const cost = costs[start] + route.cost(costEvaluator);
+                if (cost < next[end + 1])
+                {
+                    next[end + 1] = cost;
+                    slotPreds(slot, end + 1) = start;
+                }
+
+                if (route.load() > loadBound[type])
+                    break;
+            }
+        }
+
+        std::swap(costs, next);
+    }
+
+    // Walk back over the slots to determine the route (if any) each slot
+    // serves. The load bounds ensure all clients can be served, so the last
+    // slot always ends at the end of the tour.
+    std::fill(preds.begin(), preds.end(), 0);
+    auto end = numClients;
+    for (auto slot = slots.size(); slot-- != 0;)
+    {
+        auto const start = slotPreds(slot, end);
+        if (start != end)
+        {
+            preds[end] = start;
+            types[end] = slots[slot];
+            end = start;
+        }
+    }
+
+    return makeRoutes(data, tour, preds, types);
+}
+}  // namespace
+
+std::vector<Route> pyvrp::split(ProblemData const &data,
+                                std::vector<size_t> const &tour,
+                                CostEvaluator const &costEvaluator)
+{
+    for (auto const client : tour)
+        if (client < data.numDepots() || client >= data.numLocations())
+            throw std::invalid_argument("Tour contains a non-client index.");
+
+    if (data.numVehicles() == 0)
+        throw std::invalid_argument("Expected at least one vehicle.");
+
+    if (tour.empty())
+        return {};
+
+    if (isCapacityOnly(data, tour))
+        return linearSplit(data, tour, costEvaluator);
+
+    return bellmanSplit(data, tour, costEvaluator);
+}
@@ -0,0 +1,64 @@
+#ifndef PYVRP_SPLIT_H
+#define PYVRP_SPLIT_H
+
+#include "CostEvaluator.h"
+#include "ProblemData.h"
+#include "Route.h"
+
+#include <vector>
+
+namespace pyvrp
+{
+/**
+ * Splits the given giant tour into routes. A giant tour is a sequence of
+ * clients; splitting it determines where the tour is cut into routes, and
+ * which vehicle type serves each of those routes, such that the penalised
+ * cost of the resulting routes is minimal. The resulting routes respect the
+ * number of available vehicles of each vehicle type.
+ *
+ * When there is a single vehicle type, and routes are only constrained by
+ * capacity, this uses the linear-time split algorithm of [1]_. When that
+ * split uses more vehicles than are available, the tour is split again with
+ * a limited fleet, in time linear in the tour length times the number of
+ * vehicles. Both splits are optimal.
+ *
+ * Other instances use a Bellman-style shortest path computation over the
+ * positions in the tour, where each arc represents a route serving a
+ * contiguous part of the tour. Route costs are evaluated incrementally by
+ * concatenating load and duration segments. Routes are not extended far beyond
+ * their vehicle type's capacity, since such routes are essentially never part
+ * of a good split. When the resulting routes use more vehicles of some type
+ * than are available, the tour is split again, now assigning vehicles to
+ * consecutive parts of the tour in order of vehicle type. That second split is
+ * not always optimal for heterogeneous fleets.
+ *
+ * Parameters
+ * ----------
+ * data
+ *     Data instance.
+ * tour
+ *     Giant tour of clients to split.
+ * cost_evaluator
+ *     Cost evaluator used to penalise infeasible routes.
+ *
+ * Returns
+ * -------
+ * list[Route]
+ *     The routes of the split tour, in tour order.
+ *
+ * Raises
+ * ------
+ * ValueError
+ *     When the tour contains a location that is not a client.
+ *
+ * References
+ * ----------
+ * .. [1] T. Vidal. 2016. Split algorithm in O(n) for the capacitated vehicle
+ *        routing problem. *Computers & Operations Research*, 69: 40 - 47.
+ */
+std::vector<Route> split(ProblemData const &data,
+                         std::vector<size_t> const &tour,
+                         CostEvaluator const &costEvaluator);
+}  // namespace pyvrp
+
+#endif  // PYVRP_SPLIT_H
@@ -1,12 +1,13 @@
 #include "SubPopulation.h"
 
+#include <algorithm>
 #include <numeric>
 #include <stdexcept>
 
 using pyvrp::PopulationParams;
+using pyvrp::Solution;
 using pyvrp::SubPopulation;
 using const_iter = std::vector<SubPopulation::Item>::const_iterator;
-using iter = std::vector<SubPopulation::Item>::iterator;
 
 PopulationParams::PopulationParams(size_t minPopSize,
                                    size_t generationSize,
@@ -45,32 +46,38 @@ SubPopulation::SubPopulation(diversity::DiversityMeasure divOp,
 {
 }
 
-SubPopulation::~SubPopulation()
-{
-    for (auto &item : items)
-        delete item.solution;
-}
-
 void SubPopulation::add(Solution const *solution,
                         CostEvaluator const &costEvaluator)
 {
+    // Exact duplicates are rejected before any of the more expensive diversity
+    // computations. Solutions with the same hash are very likely, but not
+    // certainly, the same, so we confirm that with a full comparison.
+    auto const hash = solution->hash();
+    auto const [first, last] = hashes.equal_range(hash);
+    for (auto it = first; it != last; ++it)
+        if (*it->second == *solution)
+            return;
+
     // Copy the given solution into a new memory location, and use that from
     // now on.
-    solution = new Solution(*solution);
-    Item item = {&params, solution, 0.0, {}};
-
-    for (auto &other : items)  // update distance to other solutions
+    auto copy = std::make_shared<Solution>(*solution);
+    solution = copy.get();
+    hashes.emplace(hash, solution);
+    Item item = {&params, std::move(copy), 0.0, {}, {}};
+
+    // First compute the distances to all other solutions in one pass, and only
+    // then update the proximity structures. Each update is (amortised) O(1),
+    // unless the other solution is among an item's closest solutions.
+    std::vector<double> divs;
+    divs.reserve(items.size());
+    for (auto const &other : items)
+        divs.push_back(divOp(*solution, *other.solution));
+
+    item.proximity.reserve(items.size());
+    for (size_t idx = 0; idx != items.size(); ++idx)
     {
-        auto const div = divOp(*solution, *other.solution);
-        auto cmp = [](auto &elem, auto &value) { return elem.first < value; };
-
-        auto &oProx = other.proximity;
-        auto place = std::lower_bound(oProx.begin(), oProx.end(), div, cmp);
-        oProx.emplace(place, div, solution);
-
-        auto &iProx = item.proximity;
-        place = std::lower_bound(iProx.begin(), iProx.end(), div, cmp);
-        iProx.emplace(place, div, other.solution);
+        items[idx].addProximity(divs[idx], solution);
+        item.addProximity(divs[idx], items[idx].solution.get());
     }
 
     items.push_back(item);  // add solution
@@ -90,52 +97,69 @@ const_iter SubPopulation::cbegin() const { return items.cbegin(); }
 
 const_iter SubPopulation::cend() const { return items.cend(); }
 
-void SubPopulation::remove(iter const &iterator)
+void SubPopulation::remove(std::vector<size_t> const &indices)
 {
-    for (auto &[params, solution, fitness, proximity] : items)
-        // Remove solution from other proximities.
-        for (size_t idx = 0; idx != proximity.size(); ++idx)
-            if (proximity[idx].second == iterator->solution)
+    std::vector<bool> isRemoved(size(), false);
+    std::vector<Solution const *> removed;
+    removed.reserve(indices.size());
+
+    for (auto const idx : indices)
+    {
+        isRemoved[idx] = true;
+        removed.push_back(items[idx].solution.get());
+    }
+
+    // Remove the solutions from the proximities of the remaining items.
+    std::sort(removed.begin(), removed.end(), std::less<Solution const *>());
+    for (size_t idx = 0; idx != size(); ++idx)
+        if (!isRemoved[idx])
+            items[idx].removeProximity(removed);
+
+    for (auto const *solution : removed)
+    {
+        auto const [first, last] = hashes.equal_range(solution->hash());
+        for (auto it = first; it != last; ++it)
+            if (it->second == solution)
             {
-                proximity.erase(proximity.begin() + idx);
+                hashes.erase(it);
                 break;
             }
+    }
 
-    delete iterator->solution;  // dispose of manually allocated memory
-    items.erase(iterator);      // before the item is removed.
+    // Compact the remaining items, preserving their order.
+    size_t next = 0;
+    for (size_t idx = 0; idx != size(); ++idx)
+        if (!isRemoved[idx])
+        {
+            if (next != idx)
+                items[next] = std::move(items[idx]);
+
+            next++;
+        }
+
+    items.erase(items.begin() + next, items.end());
 }
 
 void SubPopulation::purge(CostEvaluator const &costEvaluator)
 {
-    // First we remove duplicates. This does not rely on the fitness values.
-    while (size() > params.minPopSize)
-    {
-        // Remove duplicates from the subpopulation (if they exist)
-        auto const pred = [&](auto &iterator)
-        {
-            return !iterator.proximity.empty()
-                   && *iterator.proximity[0].second == *iterator.solution;
-        };
-
-        auto const duplicate = std::find_if(items.begin(), items.end(), pred);
+    // Duplicates are never added to the subpopulation, so we only need to
+    // remove solutions based on their fitness.
+    if (size() <= params.minPopSize)
+        return;
 
-        if (duplicate == items.end())  // there are no more duplicates
-            break;
+    updateFitness(costEvaluator);
 
-        remove(duplicate);
-    }
+    // Determine the solutions with the worst fitness, and remove those. The
+    // stable sort ensures ties are broken in favour of removing older items.
+    std::vector<size_t> byFitness(size());
+    std::iota(byFitness.begin(), byFitness.end(), 0);
+    std::stable_sort(byFitness.begin(),
+                     byFitness.end(),
+                     [&](size_t a, size_t b)
+                     { return items[a].fitness > items[b].fitness; });
 
-    while (size() > params.minPopSize)
-    {
-        // Before using fitness, we must update fitness
-        updateFitness(costEvaluator);
-        auto const worstFitness = std::max_element(
-            items.begin(),
-            items.end(),
-            [](auto const &a, auto const &b) { return a.fitness < b.fitness; });
-
-        remove(worstFitness);
-    }
+    byFitness.resize(size() - params.minPopSize);
+    remove(byFitness);
 }
 
 void SubPopulation::updateFitness(CostEvaluator const &costEvaluator)
@@ -179,11 +203,61 @@ void SubPopulation::updateFitness(CostEvaluator const &costEvaluator)
 
 double SubPopulation::Item::avgDistanceClosest() const
 {
-    auto const maxSize = std::min(proximity.size(), params->nbClose);
     auto result = 0.0;
+    for (auto const &[div, _] : closest)
+        result += div;
+
+    return result / std::max<size_t>(closest.size(), 1);
+}
+
+void SubPopulation::Item::addProximity(double div, Solution const *other)
+{
+    proximity.emplace_back(div, other);
 
-    for (size_t idx = 0; idx != maxSize; ++idx)
-        result += proximity[idx].first;
+    if (closest.size() == params->nbClose
+        && (closest.empty() || div >= closest.back().first))
+        return;  // not among the closest solutions
+
+    auto cmp = [](auto &elem, auto &value) { return elem.first < value; };
+    auto place = std::lower_bound(closest.begin(), closest.end(), div, cmp);
+    closest.emplace(place, div, other);
+
+    if (closest.size() > params->nbClose)
+        closest.pop_back();
+}
+
+void SubPopulation::Item::removeProximity(
+    std::vector<Solution const *> const &others)
+{
+    auto const pred = [&](auto const &elem)
+    {
+        return std::binary_search(others.begin(),
+                                  others.end(),
+                                  elem.second,
+                                  std::less<Solution const *>());
+    };
+
+    // Order does not matter, so this removes elements by swapping with the
+    // last element, rather than shifting all subsequent elements.
+    for (size_t idx = 0; idx < proximity.size();)
+        if (pred(proximity[idx]))
+        {
+            std::swap(proximity[idx], proximity.back());
+            proximity.pop_back();
+        }
+        else
+            ++idx;
+
+    if (std::none_of(closest.begin(), closest.end(), pred))
+        return;
 
-    return result / std::max<size_t>(maxSize, 1);
+    // At least one removed solution was among the closest, so we need to
+    // determine a new set of closest solutions from the full proximity list.
+    closest.resize(std::min(proximity.size(), params->nbClose), {0.0, nullptr});
+    std::partial_sort_copy(proximity.begin(),
+                           proximity.end(),
+                           closest.begin(),
+                           closest.end(),
+                           [](auto const &lhs, auto const &rhs)
+                           { return lhs.first < rhs.first; });
 }
@@ -6,6 +6,8 @@
 #include "diversity/diversity.h"
 
 #include <functional>
+#include <memory>
+#include <unordered_map>
 #include <vector>
 
 namespace pyvrp
@@ -98,35 +100,50 @@ public:
 
         PopulationParams const *params;
 
-        // Note that this pointer is not owned by the Item - it is merely a
-        // reference to memory owned and allocated by the SubPopulation this
-        // item is part of. The SubPopulation remains responsible for managing
-        // that memory.
-        Solution const *solution;
+        // Ownership of the solution is shared with Python, which may hold on
+        // to the solution after it has been removed from the subpopulation.
+        std::shared_ptr<Solution> solution;
 
         // Fitness should be used carefully: only directly after updateFitness
         // was called. At any other moment, it will be outdated.
         double fitness;
+
+        // Distances to all other solutions in the subpopulation, in no
+        // particular order. The (at most) nbClose smallest of these are also
+        // stored in closest, in sorted order.
         Proximity proximity;
+        Proximity closest;
 
         double avgDistanceClosest() const;
+
+        // Registers the distance to the given other solution.
+        void addProximity(double div, Solution const *other);
+
+        // Removes the distances to the given other solutions, which must be
+        // sorted by address.
+        void removeProximity(std::vector<Solution const *> const &others);
     };
 
 private:
     std::vector<Item> items;
 
-    // Removes the element at the given iterator location from the items.
-    void remove(std::vector<Item>::iterator const &iterator);
+    // Maps solution hashes to the solutions in this subpopulation. Used to
+    // quickly detect duplicate solutions.
+    std::unordered_multimap<size_t, Solution const *> hashes;
+
+    // Removes the items at the given indices in a single batch: first the
+    // removed solutions are dropped from all proximity structures, and then
+    // the remaining items are compacted once.
+    void remove(std::vector<size_t> const &indices);
 
 public:
     SubPopulation(diversity::DiversityMeasure divOp,
                   PopulationParams const &params);
 
-    ~SubPopulation();
-
     /**
      * Adds the given solution to the subpopulation. Survivor selection is
      * automatically triggered when the population reaches its maximum size.
+     * Solutions that are already in the subpopulation are not added again.
      *
      * Parameters
      * ----------
@@ -148,8 +165,9 @@ public:
     /**
      * Performs survivor selection: solutions in the subpopulation are
      * purged until the population is reduced to the ``min_pop_size``.
-     * Purging happens to duplicate solutions first, and then to solutions
-     * with high biased fitness.
+     * Purging happens to solutions with high biased fitness. The fitness is
+     * computed once, after which all solutions to be purged are removed in
+     * one batch.
      *
      * Parameters
      * ----------
@@ -5,10 +5,13 @@
 #include "DynamicBitset.h"
 #include "LoadSegment.h"
 #include "Matrix.h"
+#include "PenaltyManager.h"
 #include "ProblemData.h"
 #include "RandomNumberGenerator.h"
 #include "Route.h"
+#include "RoutePool.h"
 #include "Solution.h"
+#include "Split.h"
 #include "SubPopulation.h"
 #include "pyvrp_docs.h"
 
@@ -29,10 +32,13 @@ using pyvrp::DurationSegment;
 using pyvrp::DynamicBitset;
 using pyvrp::LoadSegment;
 using pyvrp::Matrix;
+using pyvrp::PenaltyManager;
+using pyvrp::PenaltyParams;
 using pyvrp::PopulationParams;
 using pyvrp::ProblemData;
 using pyvrp::RandomNumberGenerator;
 using pyvrp::Route;
+using pyvrp::RoutePool;
 using pyvrp::Solution;
 using pyvrp::SubPopulation;
 
@@ -380,6 +386,8 @@ PYBIND11_MODULE(_pyvrp, m)
             },
             py::arg("idx"))
         .def(py::self == py::self)  // this is __eq__
+        .def("__hash__",
+             [](Route const &route) { return std::hash<Route>()(route); })
         .def(py::pickle(
             [](Route const &route) {  // __getstate__
                 // Returns a tuple that completely encodes the route's state.
@@ -439,7 +447,10 @@ PYBIND11_MODULE(_pyvrp, m)
                  return stream.str();
              });
 
-    py::class_<Solution>(m, "Solution", DOC(pyvrp, Solution))
+    // Solutions are held by shared pointer, so that Python shares ownership
+    // of the solutions stored in a subpopulation.
+    py::class_<Solution, std::shared_ptr<Solution>>(
+        m, "Solution", DOC(pyvrp, Solution))
         // Since Route implements __len__ and __getitem__, it is convertible to
         // std::vector<size_t> and thus a list of Routes is a valid argument for
         // both constructors. We want to avoid using the second constructor
@@ -485,6 +496,35 @@ PYBIND11_MODULE(_pyvrp, m)
         .def("is_feasible",
              &Solution::isFeasible,
              DOC(pyvrp, Solution, isFeasible))
+        .def_static(
+            "are_feasible",
+            [](std::vector<Solution const *> const &solutions)
+            {
+                py::array_t<bool> feasible(solutions.size());
+                auto *out = feasible.mutable_data();
+
+                py::gil_scoped_release release;
+                for (auto const *solution : solutions)
+                    *out++ = solution->isFeasible();
+
+                return feasible;
+            },
+            py::arg("solutions"),
+            R"doc(
+                Determines feasibility of each of the given solutions. This
+                is equivalent to, but more efficient than, calling
+                :meth:`~is_feasible` on each solution separately.
+
+                Parameters
+                ----------
+                solutions
+                    Solutions to check.
+
+                Returns
+                -------
+                numpy.ndarray[bool]
+                    Array of feasibility flags, one for each solution.
+            )doc")
         .def("is_group_feasible",
              &Solution::isGroupFeasible,
              DOC(pyvrp, Solution, isGroupFeasible))
@@ -606,7 +646,41 @@ PYBIND11_MODULE(_pyvrp, m)
         .def("cost",
              &CostEvaluator::cost<Solution>,
              py::arg("solution"),
-             DOC(pyvrp, CostEvaluator, cost));
+             DOC(pyvrp, CostEvaluator, cost))
+        .def(
+            "penalised_costs",
+            [](CostEvaluator const &costEvaluator,
+               std::vector<Solution const *> const &solutions)
+            {
+                std::vector<pyvrp::Cost> costs;
+                {
+                    py::gil_scoped_release release;
+                    costs = costEvaluator.penalisedCosts(solutions);
+                }
+
+                return py::array_t<pyvrp::Value>(
+                    costs.size(),
+                    reinterpret_cast<pyvrp::Value const *>(costs.data()));
+            },
+            py::arg("solutions"),
+            DOC(pyvrp, CostEvaluator, penalisedCosts))
+        .def(
+            "costs",
+            [](CostEvaluator const &costEvaluator,
+               std::vector<Solution const *> const &solutions)
+            {
+                std::vector<pyvrp::Cost> costs;
+                {
+                    py::gil_scoped_release release;
+                    costs = costEvaluator.costs(solutions);
+                }
+
+                return py::array_t<pyvrp::Value>(
+                    costs.size(),
+                    reinterpret_cast<pyvrp::Value const *>(costs.data()));
+            },
+            py::arg("solutions"),
+            DOC(pyvrp, CostEvaluator, costs));
 
     py::class_<PopulationParams>(
         m, "PopulationParams", DOC(pyvrp, PopulationParams))
@@ -631,7 +705,6 @@ PYBIND11_MODULE(_pyvrp, m)
     py::class_<SubPopulation::Item>(m, "SubPopulationItem")
         .def_readonly("solution",
                       &SubPopulation::Item::solution,
-                      py::return_value_policy::reference_internal,
                       R"doc(
                             Solution for this SubPopulationItem.
 
@@ -709,6 +782,148 @@ PYBIND11_MODULE(_pyvrp, m)
              py::arg("cost_evaluator"),
              DOC(pyvrp, SubPopulation, updateFitness));
 
+    py::class_<RoutePool>(m, "RoutePool", DOC(pyvrp, RoutePool))
+        .def(py::init<ProblemData const &, size_t>(),
+             py::arg("data"),
+             py::arg("max_size") = 1'000,
+             py::keep_alive<1, 2>())  // keep data alive
+        .def("add",
+             &RoutePool::add,
+             py::arg("solution"),
+             DOC(pyvrp, RoutePool, add))
+        .def("combine",
+             &RoutePool::combine,
+             py::call_guard<py::gil_scoped_release>(),
+             DOC(pyvrp, RoutePool, combine))
+        .def("clear", &RoutePool::clear, DOC(pyvrp, RoutePool, clear))
+        .def("__len__", &RoutePool::size, DOC(pyvrp, RoutePool, size))
+        .def_property_readonly(
+            "max_size", &RoutePool::maxSize, DOC(pyvrp, RoutePool, maxSize));
+
+    py::class_<PenaltyParams>(m, "PenaltyParams", DOC(pyvrp, PenaltyParams))
+        .def(py::init<int, int, double, double, double>(),
+             py::arg("repair_booster") = 12,
+             py::arg("solutions_between_updates") = 50,
+             py::arg("penalty_increase") = 1.34,
+             py::arg("penalty_decrease") = 0.32,
+             py::arg("target_feasible") = 0.43)
+        .def(py::self == py::self, py::arg("other"))  // this is __eq__
+        .def_readonly("repair_booster", &PenaltyParams::repairBooster)
+        .def_readonly("solutions_between_updates",
+                      &PenaltyParams::solutionsBetweenUpdates)
+        .def_readonly("penalty_increase", &PenaltyParams::penaltyIncrease)
+        .def_readonly("penalty_decrease", &PenaltyParams::penaltyDecrease)
+        .def_readonly("target_feasible", &PenaltyParams::targetFeasible)
+        .def("__repr__",
+             [](PenaltyParams const &params)
+             {
+                 std::stringstream stream;
+                 stream << "PenaltyParams("
+                        << "repair_booster=" << params.repairBooster
+                        << ", solutions_between_updates="
+                        << params.solutionsBetweenUpdates
+                        << ", penalty_increase=" << params.penaltyIncrease
+                        << ", penalty_decrease=" << params.penaltyDecrease
+                        << ", target_feasible=" << params.targetFeasible
+                        << ")";
+                 return stream.str();
+             })
+        .def(py::pickle(
+            [](PenaltyParams const &params) {  // __getstate__
+                return py::make_tuple(params.repairBooster,
+                                      params.solutionsBetweenUpdates,
+                                      params.penaltyIncrease,
+                                      params.penaltyDecrease,
+                                      params.targetFeasible);
+            },
+            [](py::tuple t) {  // __setstate__
+                return PenaltyParams(t[0].cast<int>(),
+                                     t[1].cast<int>(),
+                                     t[2].cast<double>(),
+                                     t[3].cast<double>(),
+                                     t[4].cast<double>());
+            }));
+
+    // Warns when a penalty value has been updated to its maximum value. This
+    // usually means the instance is hard or has no feasible solution at all.
+    auto const warnIfAtMax = [](bool atMax)
+    {
+        if (!atMax)
+            return;
+
+        auto const msg = R"msg(
+            A penalty parameter has reached its maximum value. This means PyVRP
+            struggles to find a feasible solution for the instance that's being
+            solved, either because the instance has no feasible solution, or it
+            is very hard to find one. Check the instance carefully to determine
+            if a feasible solution exists.
+            )msg";
+
+        auto const exceptions = py::module_::import("pyvrp.exceptions");
+        auto const category = exceptions.attr("PenaltyBoundWarning");
+        if (PyErr_WarnEx(category.ptr(), msg, 1) < 0)
+            throw py::error_already_set();
+    };
+
+    py::class_<PenaltyManager>(m, "PenaltyManager", DOC(pyvrp, PenaltyManager))
+        .def(py::init<PenaltyParams, std::array<double, 3>>(),
+             py::arg("params") = PenaltyParams(),
+             py::arg("initial_penalties") = std::array<double, 3>{20, 6, 6})
+        .def_readonly_static("MIN_PENALTY", &PenaltyManager::MIN_PENALTY)
+        .def_readonly_static("MAX_PENALTY", &PenaltyManager::MAX_PENALTY)
+        .def_readonly_static("FEAS_TOL", &PenaltyManager::FEAS_TOL)
+        .def_static("init_from",
+                    &PenaltyManager::initFrom,
+                    py::arg("data"),
+                    py::arg("params") = PenaltyParams(),
+                    py::call_guard<py::gil_scoped_release>(),
+                    DOC(pyvrp, PenaltyManager, initFrom))
+        .def(
+            "register",
+            [=](PenaltyManager &pm, Solution const &solution)
+            { warnIfAtMax(pm.registerSolution(solution)); },
+            py::arg("solution"),
+            DOC(pyvrp, PenaltyManager, registerSolution))
+        .def(
+            "register_route",
+            [=](PenaltyManager &pm, Route const &route)
+            { warnIfAtMax(pm.registerRoute(route)); },
+            py::arg("route"),
+            DOC(pyvrp, PenaltyManager, registerRoute))
+        .def("cost_evaluator",
+             &PenaltyManager::costEvaluator,
+             DOC(pyvrp, PenaltyManager, costEvaluator))
+        .def("booster_cost_evaluator",
+             &PenaltyManager::boosterCostEvaluator,
+             DOC(pyvrp, PenaltyManager, boosterCostEvaluator))
+        .def("penalties",
+             &PenaltyManager::penalties,
+             DOC(pyvrp, PenaltyManager, penalties))
+        .def_property_readonly("params",
+                               &PenaltyManager::params,
+                               DOC(pyvrp, PenaltyManager, params))
+        .def("__copy__",
+             [](PenaltyManager const &pm) { return PenaltyManager(pm); })
+        .def(
+            "__deepcopy__",
+            [](PenaltyManager const &pm, py::dict)
+            { return PenaltyManager(pm); },
+            py::arg("memo"));
+
+    m.def("average_best_edges",
+          &pyvrp::averageBestEdges,
+          py::arg("data"),
+          py::call_guard<py::gil_scoped_release>(),
+          DOC(pyvrp, averageBestEdges));
+
+    m.def("split",
+          &pyvrp::split,
+          py::arg("data"),
+          py::arg("tour"),
+          py::arg("cost_evaluator"),
+          py::call_guard<py::gil_scoped_release>(),
+          DOC(pyvrp, split));
+
     py::class_<DistanceSegment>(
         m, "DistanceSegment", DOC(pyvrp, DistanceSegment))
         .def(py::init<size_t, size_t, pyvrp::Distance>(),
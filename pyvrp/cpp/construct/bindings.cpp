@@ -0,0 +1,40 @@
+#include "construct_docs.h"
+#include "regret_insertion.h"
+#include "savings.h"
+#include "sweep.h"
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+PYBIND11_MODULE(_construct, m)
+{
+    m.def("regret_insertion",
+          &pyvrp::construct::regretInsertion,
+          py::arg("data"),
+          py::arg("cost_evaluator"),
+          py::arg("rng"),
+          py::arg("neighbours") = std::vector<std::vector<size_t>>{},
+          py::arg("num_regret") = 2,
+          DOC(pyvrp, construct, regretInsertion),
+          py::call_guard<py::gil_scoped_release>());
+
+    m.def("savings",
+          &pyvrp::construct::savings,
+          py::arg("data"),
+          py::arg("cost_evaluator"),
+          py::arg("rng"),
+          py::arg("neighbours"),
+          DOC(pyvrp, construct, savings),
+          py::call_guard<py::gil_scoped_release>());
+
+    m.def("sweep",
+          &pyvrp::construct::sweep,
+          py::arg("data"),
+          py::arg("cost_evaluator"),
+          py::arg("rng"),
+          py::arg("neighbours") = std::vector<std::vector<size_t>>{},
+          DOC(pyvrp, construct, sweep),
+          py::call_guard<py::gil_scoped_release>());
+}
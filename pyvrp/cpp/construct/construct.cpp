@@ -0,0 +1,22 @@
+#include "construct.h"
+
+std::vector<size_t>
+pyvrp::construct::selectClients(ProblemData const &data,
+                                RandomNumberGenerator &rng)
+{
+    std::vector<size_t> clients;
+    clients.reserve(data.numClients());
+
+    for (size_t idx = data.numDepots(); idx != data.numLocations(); ++idx)
+    {
+        ProblemData::Client const &clientData = data.location(idx);
+        if (clientData.required || (!clientData.group && rng.rand() < 0.5))
+            clients.push_back(idx);
+    }
+
+    for (auto const &group : data.groups())
+        if (group.required)
+            clients.push_back(group.clients()[rng.randint(group.size())]);
+
+    return clients;
+}
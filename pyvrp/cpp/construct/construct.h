@@ -0,0 +1,18 @@
+#ifndef PYVRP_CONSTRUCT_H
+#define PYVRP_CONSTRUCT_H
+
+#include "ProblemData.h"
+#include "RandomNumberGenerator.h"
+
+#include <vector>
+
+namespace pyvrp::construct
+{
+// Selects the clients a constructed solution should visit: all required
+// clients, one random client of each required client group, and randomly
+// selected other optional clients.
+std::vector<size_t> selectClients(ProblemData const &data,
+                                  RandomNumberGenerator &rng);
+}  // namespace pyvrp::construct
+
+#endif  // PYVRP_CONSTRUCT_H
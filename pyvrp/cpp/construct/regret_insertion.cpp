@@ -0,0 +1,180 @@
+#include "regret_insertion.h"
+#include "construct.h"
+
+#include "search/RegretCache.h"
+#include "search/Route.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+using pyvrp::Cost;
+using pyvrp::CostEvaluator;
+using pyvrp::Load;
+using pyvrp::ProblemData;
+using pyvrp::search::RegretCache;
+
+using SearchRoute = pyvrp::search::Route;
+
+pyvrp::Solution
+pyvrp::construct::regretInsertion(
+    ProblemData const &data,
+    CostEvaluator const &costEvaluator,
+    RandomNumberGenerator &rng,
+    [[maybe_unused]] std::vector<std::vector<size_t>> const &neighbours,
+    size_t numRegret)
+{
+    if (numRegret == 0)
+        throw std::invalid_argument("Expected num_regret > 0.");
+
+    auto clients = selectClients(data, rng);
+    std::shuffle(clients.begin(), clients.end(), rng);
+
+    // Indices of the clients that have not yet been inserted. The cache
+    // identifies clients by their index in the list of clients.
+    std::vector<size_t> unplanned(clients.size());
+    std::iota(unplanned.begin(), unplanned.end(), 0);
+
+    std::vector<SearchRoute::Node> locs;
+    locs.reserve(data.numLocations());
+    for (size_t loc = 0; loc != data.numLocations(); ++loc)
+        locs.emplace_back(loc);
+
+    // Doing this avoids re-allocations, which would break the pointer
+    // structure that Route and Route::Node use. We never open more routes than
+    // there are vehicles.
+    std::vector<SearchRoute> routes;
+    routes.reserve(data.numVehicles());
+
+    std::vector<size_t> numOpened(data.numVehicleTypes(), 0);
+    RegretCache cache(data, costEvaluator, clients.size(), numRegret);
+
+    // Opens a new empty route of the given vehicle type, and evaluates
+    // inserting the unplanned clients into it.
+    auto const open = [&](size_t vehType)
+    {
+        auto &route = routes.emplace_back(data, routes.size(), vehType);
+        numOpened[vehType]++;
+
+        for (auto const idx : unplanned)
+            cache.update(idx, &locs[clients[idx]], route);
+    };
+
+    // Inserts the client after the given node, and updates the insertion
+    // costs of the modified route. When the route was empty and there are
+    // more vehicles of its type available, a new empty route of that type is
+    // opened to replace it.
+    auto const insert = [&](size_t idx, SearchRoute::Node *after)
+    {
+        auto *route = after->route();
+        auto const vehType = route->vehicleType();
+        auto const &vehTypeData = data.vehicleType(vehType);
+
+        if (route->empty() && numOpened[vehType] < vehTypeData.numAvailable)
+            open(vehType);
+
+        route->insert(after->idx() + 1, &locs[clients[idx]]);
+        route->update();
+
+        for (auto const other : unplanned)
+            cache.update(other, &locs[clients[other]], *route);
+    };
+
+    // Remove the client at the given position from the unplanned clients, and
+    // return its index.
+    auto const take = [&](size_t pos)
+    {
+        auto const idx = unplanned[pos];
+        std::swap(unplanned[pos], unplanned.back());
+        unplanned.pop_back();
+        return idx;
+    };
+
+    for (size_t vehType = 0; vehType != data.numVehicleTypes(); ++vehType)
+        open(vehType);
+
+    // Seed the number of routes that are needed to carry the total demand with
+    // random clients. Each seed client is inserted into its cheapest new route.
+    Load maxCapacity = 0;
+    for (auto const &vehType : data.vehicleTypes())
+        maxCapacity = std::max(maxCapacity, vehType.capacity);
+
+    Load delivery = 0;
+    Load pickup = 0;
+    for (auto const client : clients)
+    {
+        ProblemData::Client const &clientData = data.location(client);
+        delivery += clientData.delivery;
+        pickup += clientData.pickup;
+    }
+
+    size_t numSeeds = 0;
+    if (maxCapacity > 0)
+    {
+        auto const demand = std::max(delivery, pickup).get();
+        auto const capacity = maxCapacity.get();
+        numSeeds = static_cast<size_t>((demand + capacity - 1) / capacity);
+    }
+
+    numSeeds = std::min({numSeeds, data.numVehicles(), unplanned.size()});
+
+    for (size_t seed = 0; seed != numSeeds; ++seed)
+    {
+        auto const idx = take(unplanned.size() - 1);
+
+        RegretCache::Insertion best = {std::numeric_limits<Cost>::max()};
+        for (size_t route = 0; route != routes.size(); ++route)
+            if (routes[route].empty())
+            {
+                auto const &insertion = cache.insertion(idx, route);
+                if (insertion.cost < best.cost)
+                    best = insertion;
+            }
+
+        insert(idx, best.after);
+    }
+
+    // Regret insertion. We insert the client with the largest regret value
+    // into its best route, breaking ties in favour of the cheapest insertion.
+    while (!unplanned.empty())
+    {
+        size_t bestPos = 0;
+        auto bestRegret = std::numeric_limits<Cost>::min();
+        auto bestCost = std::numeric_limits<Cost>::max();
+
+        for (size_t pos = 0; pos != unplanned.size(); ++pos)
+        {
+            auto const idx = unplanned[pos];
+            auto const regret = cache.regret(idx);
+            auto const minCost = cache.best(idx).cost;
+
+            if (regret > bestRegret
+                || (regret == bestRegret && minCost < bestCost))
+            {
+                bestPos = pos;
+                bestRegret = regret;
+                bestCost = minCost;
+            }
+        }
+
+        auto const idx = take(bestPos);
+        insert(idx, cache.best(idx).after);
+    }
+
+    std::vector<Route> solRoutes;
+    for (auto const &route : routes)
+    {
+        if (route.empty())
+            continue;
+
+        std::vector<size_t> visits;
+        visits.reserve(route.size());
+        for (auto *node : route)
+            visits.push_back(node->client());
+
+        solRoutes.emplace_back(data, visits, route.vehicleType());
+    }
+
+    return {data, solRoutes};
+}
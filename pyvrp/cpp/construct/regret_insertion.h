@@ -0,0 +1,72 @@
+#ifndef PYVRP_CONSTRUCT_REGRET_INSERTION_H
+#define PYVRP_CONSTRUCT_REGRET_INSERTION_H
+
+#include "CostEvaluator.h"
+#include "ProblemData.h"
+#include "RandomNumberGenerator.h"
+#include "Solution.h"
+
+#include <vector>
+
+namespace pyvrp::construct
+{
+/**
+ * Parallel regret insertion construction heuristic [1]_. This heuristic first
+ * opens a number of routes, each with a random seed client. The number of
+ * such routes is the total client demand divided by the largest vehicle
+ * capacity, rounded up. It then repeatedly inserts the client with the largest
+ * regret value into its best position. The regret value of a client is the
+ * sum of the differences in insertion cost between its best insertion into
+ * each of the best ``num_regret`` routes, and its best insertion overall.
+ * Clients that would be expensive to insert later are thus inserted first.
+ *
+ * Besides the open routes, each client may also be inserted into a new route
+ * of each vehicle type that has vehicles available. Insertion costs are
+ * computed using the given cost evaluator, and are cached per route: after
+ * each insertion, only the costs of inserting into the modified route are
+ * recomputed.
+ *
+ * The solution visits all required clients, one client of each required
+ * client group, and randomly selected other optional clients.
+ *
+ * Parameters
+ * ----------
+ * data
+ *     Problem data instance.
+ * cost_evaluator
+ *     Cost evaluator to use when evaluating insertion costs.
+ * rng
+ *     Random number generator.
+ * neighbours
+ *     Neighbours of each location. Regret insertion evaluates all insertion
+ *     positions, so it does not use these, and they may be omitted.
+ * num_regret
+ *     Number of routes to consider when computing a client's regret value.
+ *     Default 2.
+ *
+ * Returns
+ * -------
+ * Solution
+ *     The constructed solution.
+ *
+ * Raises
+ * ------
+ * ValueError
+ *     When ``num_regret`` is zero.
+ *
+ * References
+ * ----------
+ * .. [1] J.-Y. Potvin and J.-M. Rousseau. 1993. A parallel route building
+ *        algorithm for the vehicle routing and scheduling problem with time
+ *        windows. *European Journal of Operational Research*, 66(3):
+ *        331 - 340.
+ */
+Solution
+regretInsertion(ProblemData const &data,
+                CostEvaluator const &costEvaluator,
+                RandomNumberGenerator &rng,
+                std::vector<std::vector<size_t>> const &neighbours = {},
+                size_t numRegret = 2);
+}  // namespace pyvrp::construct
+
+#endif  // PYVRP_CONSTRUCT_REGRET_INSERTION_H
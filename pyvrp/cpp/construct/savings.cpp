@@ -0,0 +1,180 @@
+#include "savings.h"
+#include "construct.h"
+
+#include "DurationSegment.h"
+#include "LoadSegment.h"
+#include "RouteGeometry.h"
+#include "Split.h"
+
+#include <algorithm>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+#include <tuple>
+
+using pyvrp::Distance;
+using pyvrp::DurationSegment;
+using pyvrp::LoadSegment;
+using pyvrp::ProblemData;
+using pyvrp::Route;
+
+namespace
+{
+size_t constexpr NONE = std::numeric_limits<size_t>::max();
+
+// Route under construction, from the first to the last client. The distance
+// and segments do not include the depots.
+struct PartialRoute
+{
+    size_t first;
+    size_t last;
+    Distance distance;
+    LoadSegment ls;
+    DurationSegment ds;
+};
+}  // namespace
+
+pyvrp::Solution pyvrp::construct::savings(
+    ProblemData const &data,
+    CostEvaluator const &costEvaluator,
+    RandomNumberGenerator &rng,
+    std::vector<std::vector<size_t>> const &neighbours)
+{
+    if (neighbours.size() != data.numLocations())
+        throw std::invalid_argument("Neighbourhood dimensions do not match.");
+
+    for (auto const &locNeighbours : neighbours)
+        if (std::any_of(locNeighbours.begin(),
+                        locNeighbours.end(),
+                        [&](auto loc) { return loc >= data.numLocations(); }))
+            throw std::invalid_argument("Neighbour is not a valid location.");
+
+    auto const clients = selectClients(data, rng);
+    auto const shape = 0.5 + rng.rand();
+
+    // Merged routes must be feasible for the vehicle type with the largest
+    // capacity. The split at the end determines the actual vehicle types.
+    auto const &vehTypes = data.vehicleTypes();
+    auto const vehTypeIdx = std::distance(
+        vehTypes.begin(),
+        std::max_element(vehTypes.begin(),
+                         vehTypes.end(),
+                         [](auto const &lhs, auto const &rhs)
+                         { return lhs.capacity < rhs.capacity; }));
+    auto const &vehType = vehTypes[vehTypeIdx];
+
+    auto const &distances = data.distanceMatrix(vehType.profile);
+    auto const &durations = data.durationMatrix(vehType.profile);
+
+    // Max-heap of the savings of merging the route ending at the first client
+    // with the route starting at the second client, for each selected client
+    // and its selected neighbours.
+    std::vector<bool> selected(data.numLocations(), false);
+    for (auto const client : clients)
+        selected[client] = true;
+
+    using Saving = std::tuple<double, size_t, size_t>;
+    std::vector<Saving> candidates;
+    for (auto const first : clients)
+        for (auto const second : neighbours[first])
+        {
+            if (second == first || !selected[second])
+                continue;
+
+            auto const toDepot = distances(first, vehType.endDepot);
+            auto const fromDepot = distances(vehType.startDepot, second);
+            auto const between = distances(first, second);
+
+            auto const saving = static_cast<double>(toDepot + fromDepot)
+                                - shape * static_cast<double>(between);
+
+            if (saving > 0)
+                candidates.emplace_back(saving, first, second);
+        }
+
+    std::priority_queue<Saving> queue(std::less<Saving>(),
+                                      std::move(candidates));
+
+    // Initially, each client is on its own route. Merged routes are stored at
+    // the position of their representative client, which we find by following
+    // the rep links.
+    std::vector<size_t> pos(data.numLocations(), NONE);
+    std::vector<size_t> rep(clients.size());
+    std::vector<size_t> next(data.numLocations(), NONE);
+    std::vector<PartialRoute> routes;
+    routes.reserve(clients.size());
+
+    for (size_t idx = 0; idx != clients.size(); ++idx)
+    {
+        auto const client = clients[idx];
+        ProblemData::Client const &clientData = data.location(client);
+        routes.push_back(
+            {client, client, 0, {clientData}, {client, clientData}});
+
+        pos[client] = idx;
+        rep[idx] = idx;
+    }
+
+    auto const find = [&](size_t client)
+    {
+        auto idx = pos[client];
+        while (rep[idx] != idx)
+            idx = rep[idx] = rep[rep[idx]];  // path halving
+
+        return idx;
+    };
+
+    DurationSegment const startDS(vehType.startDepot, vehType);
+    DurationSegment const endDS(vehType.endDepot, vehType);
+
+    while (!queue.empty())
+    {
+        auto const [_, first, second] = queue.top();
+        queue.pop();
+
+        auto const firstRep = find(first);
+        auto const secondRep = find(second);
+        auto const &lhs = routes[firstRep];
+        auto const &rhs = routes[secondRep];
+
+        if (firstRep == secondRep || lhs.last != first || rhs.first != second)
+            continue;
+
+        auto const ls = LoadSegment::merge(lhs.ls, rhs.ls);
+        if (ls.load() > vehType.capacity)
+            continue;
+
+        auto const ds = DurationSegment::merge(durations, lhs.ds, rhs.ds);
+        auto const route
+            = DurationSegment::merge(durations, startDS, ds, endDS);
+        if (route.timeWarp(vehType.maxDuration) > 0)
+            continue;
+
+        auto const dist
+            = lhs.distance + distances(first, second) + rhs.distance;
+        auto const routeDist = distances(vehType.startDepot, lhs.first) + dist
+                               + distances(rhs.last, vehType.endDepot);
+        if (routeDist > vehType.maxDistance)
+            continue;
+
+        next[first] = second;
+        rep[secondRep] = firstRep;
+        routes[firstRep] = {lhs.first, rhs.last, dist, ls, ds};
+    }
+
+    std::vector<Route> merged;
+    for (size_t idx = 0; idx != clients.size(); ++idx)
+    {
+        if (rep[idx] != idx)
+            continue;
+
+        std::vector<size_t> visits;
+        for (auto curr = routes[idx].first; curr != NONE; curr = next[curr])
+            visits.push_back(curr);
+
+        merged.emplace_back(data, std::move(visits), vehTypeIdx);
+    }
+
+    auto const tour = giantTour(data, merged);
+    return {data, split(data, tour, costEvaluator)};
+}
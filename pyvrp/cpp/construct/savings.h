@@ -0,0 +1,70 @@
+#ifndef PYVRP_CONSTRUCT_SAVINGS_H
+#define PYVRP_CONSTRUCT_SAVINGS_H
+
+#include "CostEvaluator.h"
+#include "ProblemData.h"
+#include "RandomNumberGenerator.h"
+#include "Solution.h"
+
+#include <vector>
+
+namespace pyvrp::construct
+{
+/**
+ * Clarke and Wright savings construction heuristic [1]_. This heuristic starts
+ * with a separate route for each client, and repeatedly merges the end of one
+ * route with the start of another, in order of decreasing savings. Merging
+ * the route ending at client :math:`i` with the route starting at client
+ * :math:`j` saves
+ *
+ * .. math::
+ *
+ *    s_{ij} = d_{i0} + d_{0j} - \lambda d_{ij},
+ *
+ * where :math:`\lambda` is a shape parameter that is drawn uniformly from
+ * :math:`[0.5, 1.5]`, which diversifies the constructed solutions. Only
+ * pairs of clients where the second client is a neighbour of the first are
+ * considered, and merges are only performed when the merged route remains
+ * feasible for the vehicle type with the largest capacity. The routes are
+ * then concatenated into a giant tour, which is split into routes using
+ * :func:`~pyvrp._pyvrp.split`. This assigns vehicle types to the routes,
+ * and ensures the number of available vehicles is respected.
+ *
+ * The solution visits all required clients, one client of each required
+ * client group, and randomly selected other optional clients.
+ *
+ * Parameters
+ * ----------
+ * data
+ *     Problem data instance.
+ * cost_evaluator
+ *     Cost evaluator to use when splitting the giant tour into routes.
+ * rng
+ *     Random number generator.
+ * neighbours
+ *     Neighbours of each location, for example the granular neighbourhood
+ *     computed by :func:`~pyvrp.search.neighbourhood.compute_neighbours`.
+ *
+ * Returns
+ * -------
+ * Solution
+ *     The constructed solution.
+ *
+ * Raises
+ * ------
+ * ValueError
+ *     When the neighbourhood does not match the data instance.
+ *
+ * References
+ * ----------
+ * .. [1] G. Clarke and J. W. Wright. 1964. Scheduling of vehicles from a
+ *        central depot to a number of delivery points. *Operations Research*,
+ *        12(4): 568 - 581.
+ */
+Solution savings(ProblemData const &data,
+                 CostEvaluator const &costEvaluator,
+                 RandomNumberGenerator &rng,
+                 std::vector<std::vector<size_t>> const &neighbours);
+}  // namespace pyvrp::construct
+
+#endif  // PYVRP_CONSTRUCT_SAVINGS_H
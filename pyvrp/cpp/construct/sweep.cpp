@@ -0,0 +1,40 @@
+#include "sweep.h"
+#include "construct.h"
+
+#include "Split.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+pyvrp::Solution pyvrp::construct::sweep(
+    ProblemData const &data,
+    CostEvaluator const &costEvaluator,
+    RandomNumberGenerator &rng,
+    [[maybe_unused]] std::vector<std::vector<size_t>> const &neighbours)
+{
+    auto clients = selectClients(data, rng);
+
+    // Angle of each client w.r.t. the centroid, measured from the random start
+    // angle in the random sweep direction, in [0, 2 pi).
+    auto constexpr TWO_PI = 2 * std::numbers::pi;
+    auto const [dataX, dataY] = data.centroid();
+    auto const start = TWO_PI * rng.rand();
+    auto const direction = rng.rand() < 0.5 ? 1.0 : -1.0;
+
+    std::vector<double> angles(data.numLocations(), 0);
+    for (auto const client : clients)
+    {
+        ProblemData::Client const &clientData = data.location(client);
+        auto const x = static_cast<double>(clientData.x) - dataX;
+        auto const y = static_cast<double>(clientData.y) - dataY;
+        auto const angle = direction * std::atan2(y, x) - start + 2 * TWO_PI;
+        angles[client] = std::fmod(angle, TWO_PI);
+    }
+
+    std::sort(clients.begin(),
+              clients.end(),
+              [&](auto lhs, auto rhs) { return angles[lhs] < angles[rhs]; });
+
+    return {data, split(data, clients, costEvaluator)};
+}
@@ -0,0 +1,51 @@
+#ifndef PYVRP_CONSTRUCT_SWEEP_H
+#define PYVRP_CONSTRUCT_SWEEP_H
+
+#include "CostEvaluator.h"
+#include "ProblemData.h"
+#include "RandomNumberGenerator.h"
+#include "Solution.h"
+
+#include <vector>
+
+namespace pyvrp::construct
+{
+/**
+ * Sweep construction heuristic. This heuristic orders the clients by their
+ * polar angle with respect to the centroid of all clients, starting from a
+ * random angle, and in a random direction. The resulting giant tour is then
+ * split into routes using :func:`~pyvrp._pyvrp.split`. See [1]_ for the
+ * original sweep heuristic.
+ *
+ * The solution visits all required clients, one client of each required
+ * client group, and randomly selected other optional clients.
+ *
+ * Parameters
+ * ----------
+ * data
+ *     Problem data instance.
+ * cost_evaluator
+ *     Cost evaluator to use when splitting the giant tour into routes.
+ * rng
+ *     Random number generator.
+ * neighbours
+ *     Neighbours of each location. The sweep heuristic does not use these,
+ *     and they may be omitted.
+ *
+ * Returns
+ * -------
+ * Solution
+ *     The constructed solution.
+ *
+ * References
+ * ----------
+ * .. [1] B. E. Gillett and L. R. Miller. 1974. A heuristic algorithm for the
+ *        vehicle-dispatch problem. *Operations Research*, 22(2): 340 - 349.
+ */
+Solution sweep(ProblemData const &data,
+               CostEvaluator const &costEvaluator,
+               RandomNumberGenerator &rng,
+               std::vector<std::vector<size_t>> const &neighbours = {});
+}  // namespace pyvrp::construct
+
+#endif  // PYVRP_CONSTRUCT_SWEEP_H
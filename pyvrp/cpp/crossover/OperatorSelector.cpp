@@ -0,0 +1,107 @@
+#include "OperatorSelector.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+using pyvrp::crossover::OperatorSelector;
+
+OperatorSelector::OperatorSelector(size_t numOperators, double exploration)
+    : exploration_(exploration), stats_(numOperators)
+{
+    if (numOperators == 0)
+        throw std::invalid_argument("Expected num_operators > 0.");
+
+    if (exploration < 0)
+        throw std::invalid_argument("Expected exploration >= 0.");
+}
+
+double OperatorSelector::rate(Statistics const &stats) const
+{
+    // Durations are clamped to at least a nanosecond to prevent division by
+    // zero. An operator that reports (almost) no time thus gets a very large
+    // rate as soon as it makes any improvement, and is then preferred.
+    return stats.improvement / std::max(stats.duration, 1e-9);
+}
+
+size_t OperatorSelector::select() const
+{
+    for (size_t op = 0; op != stats_.size(); ++op)
+        if (stats_[op].numUpdates == 0)
+            return op;
+
+    // Reward rates are in whatever unit the improvements and durations are
+    // measured in, so we normalise them by the best rate to make them
+    // comparable with the exploration term.
+    double maxRate = 0;
+    for (auto const &stats : stats_)
+        maxRate = std::max(maxRate, rate(stats));
+
+    auto const logUpdates = std::log(static_cast<double>(numUpdates_));
+
+    size_t best = 0;
+    double bestBound = -1;
+    for (size_t op = 0; op != stats_.size(); ++op)
+    {
+        auto const &stats = stats_[op];
+        auto const mean = maxRate > 0 ? rate(stats) / maxRate : 0;
+        auto const numUpdates = static_cast<double>(stats.numUpdates);
+        auto const bound
+            = mean + exploration_ * std::sqrt(logUpdates / numUpdates);
+
+        if (bound > bestBound)
+        {
+            best = op;
+            bestBound = bound;
+        }
+    }
+
+    return best;
+}
+
+void OperatorSelector::update(size_t op, double improvement, double duration)
+{
+    if (op >= stats_.size())
+        throw std::out_of_range("Operator index out of range.");
+
+    if (duration < 0)
+        throw std::invalid_argument("Expected duration >= 0.");
+
+    auto &stats = stats_[op];
+    stats.numUpdates++;
+    stats.improvement += std::max(improvement, 0.0);
+    stats.duration += duration;
+    numUpdates_++;
+}
+
+size_t OperatorSelector::numOperators() const { return stats_.size(); }
+
+std::vector<size_t> OperatorSelector::numUpdates() const
+{
+    std::vector<size_t> numUpdates;
+    numUpdates.reserve(stats_.size());
+    for (auto const &stats : stats_)
+        numUpdates.push_back(stats.numUpdates);
+
+    return numUpdates;
+}
+
+std::vector<double> OperatorSelector::improvements() const
+{
+    std::vector<double> improvements;
+    improvements.reserve(stats_.size());
+    for (auto const &stats : stats_)
+        improvements.push_back(stats.improvement);
+
+    return improvements;
+}
+
+std::vector<double> OperatorSelector::durations() const
+{
+    std::vector<double> durations;
+    durations.reserve(stats_.size());
+    for (auto const &stats : stats_)
+        durations.push_back(stats.duration);
+
+    return durations;
+}
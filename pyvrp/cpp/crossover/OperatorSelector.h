@@ -0,0 +1,105 @@
+#ifndef PYVRP_CROSSOVER_OPERATORSELECTOR_H
+#define PYVRP_CROSSOVER_OPERATORSELECTOR_H
+
+#include <cstddef>
+#include <vector>
+
+namespace pyvrp::crossover
+{
+/**
+ * OperatorSelector(num_operators: int, exploration: float = 1.0)
+ *
+ * Adaptive operator selection using an upper confidence bound (UCB) bandit
+ * policy. Each operator's reward is the improvement it obtained per unit of
+ * time spent, and the selector balances exploiting operators with a high
+ * reward rate against exploring operators that have been tried only rarely.
+ *
+ * Parameters
+ * ----------
+ * num_operators
+ *     Number of operators to select from.
+ * exploration
+ *     Exploration weight :math:`c \ge 0`. Larger values favour operators that
+ *     have been tried less often; zero selects greedily on the reward rate.
+ *
+ * Raises
+ * ------
+ * ValueError
+ *     When ``num_operators`` is zero, or ``exploration`` is negative.
+ */
+class OperatorSelector
+{
+    struct Statistics
+    {
+        size_t numUpdates = 0;
+        double improvement = 0;
+        double duration = 0;
+    };
+
+    double const exploration_;
+    std::vector<Statistics> stats_;
+    size_t numUpdates_ = 0;
+
+    // Improvement per unit of time of the given operator.
+    [[nodiscard]] double rate(Statistics const &stats) const;
+
+public:
+    OperatorSelector(size_t numOperators, double exploration = 1.0);
+
+    /**
+     * Selects the next operator to apply. Operators that have not yet been
+     * updated are selected first. After that, the operator with the highest
+     * upper confidence bound on its normalised reward rate is selected.
+     *
+     * Returns
+     * -------
+     * int
+     *     Index of the selected operator.
+     */
+    [[nodiscard]] size_t select() const;
+
+    /**
+     * Updates the statistics of the given operator after it has been applied.
+     *
+     * Parameters
+     * ----------
+     * op
+     *     Index of the applied operator.
+     * improvement
+     *     Improvement obtained by applying the operator. Negative values are
+     *     treated as no improvement.
+     * duration
+     *     Time spent applying the operator, for example in seconds.
+     *
+     * Raises
+     * ------
+     * IndexError
+     *     When ``op`` is not a valid operator index.
+     * ValueError
+     *     When ``duration`` is negative.
+     */
+    void update(size_t op, double improvement, double duration);
+
+    /**
+     * Returns the number of operators.
+     */
+    [[nodiscard]] size_t numOperators() const;
+
+    /**
+     * Returns the number of updates of each operator.
+     */
+    [[nodiscard]] std::vector<size_t> numUpdates() const;
+
+    /**
+     * Returns the total improvement obtained by each operator.
+     */
+    [[nodiscard]] std::vector<double> improvements() const;
+
+    /**
+     * Returns the total time spent on each operator.
+     */
+    [[nodiscard]] std::vector<double> durations() const;
+};
+}  // namespace pyvrp::crossover
+
+#endif  // PYVRP_CROSSOVER_OPERATORSELECTOR_H
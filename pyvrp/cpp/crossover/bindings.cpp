@@ -1,19 +1,61 @@
+#include "OperatorSelector.h"
 #include "crossover_docs.h"
+#include "giant_tour_crossover.h"
 #include "ordered_crossover.h"
 #include "selective_route_exchange.h"
 
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
 
 namespace py = pybind11;
 
+using pyvrp::crossover::OperatorSelector;
+
 PYBIND11_MODULE(_crossover, m)
 {
+    py::class_<OperatorSelector>(
+        m, "OperatorSelector", DOC(pyvrp, crossover, OperatorSelector))
+        .def(py::init<size_t, double>(),
+             py::arg("num_operators"),
+             py::arg("exploration") = 1.0)
+        .def("select",
+             &OperatorSelector::select,
+             DOC(pyvrp, crossover, OperatorSelector, select))
+        .def("update",
+             &OperatorSelector::update,
+             py::arg("op"),
+             py::arg("improvement"),
+             py::arg("duration"),
+             DOC(pyvrp, crossover, OperatorSelector, update))
+        .def("num_operators",
+             &OperatorSelector::numOperators,
+             DOC(pyvrp, crossover, OperatorSelector, numOperators))
+        .def("num_updates",
+             &OperatorSelector::numUpdates,
+             DOC(pyvrp, crossover, OperatorSelector, numUpdates))
+        .def("improvements",
+             &OperatorSelector::improvements,
+             DOC(pyvrp, crossover, OperatorSelector, improvements))
+        .def("durations",
+             &OperatorSelector::durations,
+             DOC(pyvrp, crossover, OperatorSelector, durations));
+
+    m.def("giant_tour_crossover",
+          &pyvrp::crossover::giantTourCrossover,
+          py::arg("parents"),
+          py::arg("data"),
+          py::arg("cost_evaluator"),
+          py::arg("indices"),
+          DOC(pyvrp, crossover, giantTourCrossover),
+          py::call_guard<py::gil_scoped_release>());
+
     m.def("ordered_crossover",
           &pyvrp::crossover::orderedCrossover,
           py::arg("parents"),
           py::arg("data"),
           py::arg("indices"),
-          DOC(pyvrp, crossover, orderedCrossover));
+          DOC(pyvrp, crossover, orderedCrossover),
+          py::call_guard<py::gil_scoped_release>());
 
     m.def("selective_route_exchange",
           &pyvrp::crossover::selectiveRouteExchange,
@@ -22,5 +64,6 @@ PYBIND11_MODULE(_crossover, m)
           py::arg("cost_evaluator"),
           py::arg("start_indices"),
           py::arg("num_moved_routes"),
-          DOC(pyvrp, crossover, selectiveRouteExchange));
+          DOC(pyvrp, crossover, selectiveRouteExchange),
+          py::call_guard<py::gil_scoped_release>());
 }
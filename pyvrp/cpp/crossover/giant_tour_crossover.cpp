@@ -0,0 +1,22 @@
+#include "giant_tour_crossover.h"
+
+#include "RouteGeometry.h"
+#include "Split.h"
+#include "ordered_crossover.h"
+
+#include <cassert>
+
+pyvrp::Solution pyvrp::crossover::giantTourCrossover(
+    std::pair<Solution const *, Solution const *> const &parents,
+    ProblemData const &data,
+    CostEvaluator const &costEvaluator,
+    std::pair<size_t, size_t> const &indices)
+{
+    assert(parents.first->numClients() > 0 && parents.second->numClients() > 0);
+
+    auto const tour1 = giantTour(data, parents.first->routes());
+    auto const tour2 = giantTour(data, parents.second->routes());
+    auto const tour = orderedCrossoverVisits(tour1, tour2, data, indices);
+
+    return {data, split(data, tour, costEvaluator)};
+}
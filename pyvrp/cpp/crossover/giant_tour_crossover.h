@@ -0,0 +1,34 @@
+#ifndef PYVRP_CROSSOVER_GIANT_TOUR_CROSSOVER_H
+#define PYVRP_CROSSOVER_GIANT_TOUR_CROSSOVER_H
+
+#include "CostEvaluator.h"
+#include "ProblemData.h"
+#include "Solution.h"
+
+#include <utility>
+
+namespace pyvrp::crossover
+{
+/**
+ * Performs an ordered crossover (OX) operation on the giant tours of the two
+ * given parents, and splits the resulting giant tour into routes. The giant
+ * tour of a solution concatenates its routes, in order of their polar angle
+ * with respect to the centroid of all clients.
+ *
+ * @param parents        The parent solutions.
+ * @param data           The problem data.
+ * @param costEvaluator  Cost evaluator used to split the offspring giant tour.
+ * @param indices        Tuple of [start, end) indices of the first giant tour
+ *                       to use.
+ * @return A new offspring.
+ */
+// The above is an internal docstring: the giant tour crossover is wrapped on
+// the Python side and also documented there.
+Solution giantTourCrossover(
+    std::pair<Solution const *, Solution const *> const &parents,
+    ProblemData const &data,
+    CostEvaluator const &costEvaluator,
+    std::pair<size_t, size_t> const &indices);
+}  // namespace pyvrp::crossover
+
+#endif  // PYVRP_CROSSOVER_GIANT_TOUR_CROSSOVER_H
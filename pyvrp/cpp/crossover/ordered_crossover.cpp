@@ -23,45 +23,59 @@ pyvrp::Solution pyvrp::crossover::orderedCrossover(
     assert(data.numVehicles() == 1);
     assert(parents.first->numClients() > 0 && parents.second->numClients() > 0);
 
+    auto const &route1 = parents.first->routes()[0];
+    auto const &route2 = parents.second->routes()[0];
+    auto const offspring = orderedCrossoverVisits(
+        route1.visits(), route2.visits(), data, indices);
+
+    return {data, {offspring}};
+}
+
+std::vector<size_t> pyvrp::crossover::orderedCrossoverVisits(
+    std::vector<size_t> const &first,
+    std::vector<size_t> const &second,
+    ProblemData const &data,
+    std::pair<size_t, size_t> const &indices)
+{
+    assert(!first.empty() && !second.empty());
+
     auto const [start, end] = indices;
     auto const numClients = data.numClients();
 
-    // New route. This route is initially empty, indicated by all UNUSED
-    // values. Any such values that remain after crossover are filtered away.
-    std::vector<Client> newRoute(numClients, UNUSED);
+    // New visits. These are initially empty, indicated by all UNUSED values.
+    // Any such values that remain after crossover are filtered away.
+    std::vector<Client> newVisits(numClients, UNUSED);
     DynamicBitset isInserted(data.numLocations());  // tracks inserted clients
 
-    // Insert the clients from the first route into the new route, from start
-    // to end (possibly wrapping around the end of the route).
+    // Insert the clients from the first visits into the new visits, from start
+    // to end (possibly wrapping around the end of the visits).
     size_t insertIdx = start;
-    auto const &route1 = parents.first->routes()[0];
-    for (; insertIdx % route1.size() != end % route1.size(); ++insertIdx)
+    for (; insertIdx % first.size() != end % first.size(); ++insertIdx)
     {
-        newRoute[insertIdx % numClients] = route1[insertIdx % route1.size()];
-        isInserted[route1[insertIdx % route1.size()]] = true;
+        newVisits[insertIdx % numClients] = first[insertIdx % first.size()];
+        isInserted[first[insertIdx % first.size()]] = true;
     }
 
-    // Fill the route with clients from the second parent, in the order of
-    // their visits in the second route.
-    auto const &route2 = parents.second->routes()[0];
-    for (size_t idx = 0; idx != route2.size(); ++idx)
+    // Fill the new visits with clients from the second visits, in the order in
+    // which they are visited there.
+    for (size_t idx = 0; idx != second.size(); ++idx)
     {
-        Client const client = route2[(end + idx) % route2.size()];
+        Client const client = second[(end + idx) % second.size()];
         if (!isInserted[client])
         {
-            newRoute[insertIdx % numClients] = client;
+            newVisits[insertIdx % numClients] = client;
             insertIdx++;
         }
     }
 
-    // Remove the UNUSED values from the new route. These were needed because
-    // we cannot assume both parent solutions have all the same clients (for
-    // example, solutions to instances with optional clients typically do not).
+    // Remove the UNUSED values from the new visits. These were needed because
+    // we cannot assume both parents have all the same clients (for example,
+    // solutions to instances with optional clients typically do not).
     std::vector<Client> offspring;
-    std::copy_if(newRoute.begin(),
-                 newRoute.end(),
+    std::copy_if(newVisits.begin(),
+                 newVisits.end(),
                  std::back_inserter(offspring),
                  [](auto client) { return client != UNUSED; });
 
-    return {data, {offspring}};
+    return offspring;
 }
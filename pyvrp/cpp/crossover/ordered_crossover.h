@@ -7,6 +7,7 @@
 #include "Solution.h"
 
 #include <utility>
+#include <vector>
 
 namespace pyvrp::crossover
 {
@@ -27,6 +28,18 @@ Solution
 orderedCrossover(std::pair<Solution const *, Solution const *> const &parents,
                  ProblemData const &data,
                  std::pair<size_t, size_t> const &indices);
+
+// Performs the OX operation on the given sequences of client visits, and
+// returns the visits of the offspring. The clients between the [start, end)
+// indices of the first sequence are copied into the offspring, and any missing
+// clients that are present in the second sequence are then copied in as well.
+// This does not assume the visits come from a single route, and is also used
+// by the giant tour crossover.
+std::vector<size_t>
+orderedCrossoverVisits(std::vector<size_t> const &first,
+                       std::vector<size_t> const &second,
+                       ProblemData const &data,
+                       std::pair<size_t, size_t> const &indices);
 }  // namespace pyvrp::crossover
 
 #endif  // PYVRP_CROSSOVER_ORDERED_CROSSOVER_H
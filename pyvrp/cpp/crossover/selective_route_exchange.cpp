@@ -1,33 +1,42 @@
 #include "selective_route_exchange.h"
 
 #include "DynamicBitset.h"
+#include "RouteGeometry.h"
 
-#include <cmath>
+#include <algorithm>
 #include <vector>
 
 using Client = size_t;
 using Clients = std::vector<Client>;
+using pyvrp::Cost;
 using Route = pyvrp::Route;
 using Routes = std::vector<Route>;
 
 namespace
 {
-// Angle of the given route w.r.t. the centroid of all client locations.
-double routeAngle(pyvrp::ProblemData const &data, Route const &route)
-{
-    auto const [dataX, dataY] = data.centroid();
-    auto const [routeX, routeY] = route.centroid();
-    return std::atan2(routeY - dataY, routeX - dataX);
-}
-
 Routes sortByAscAngle(pyvrp::ProblemData const &data, Routes routes)
 {
     auto cmp = [&data](Route const &a, Route const &b)
-    { return routeAngle(data, a) < routeAngle(data, b); };
+    { return pyvrp::routeAngle(data, a) < pyvrp::routeAngle(data, b); };
 
     std::sort(routes.begin(), routes.end(), cmp);
     return routes;
 }
+
+// Contribution of the given route to the penalised cost of a solution that
+// contains it. This excludes the total prize value of all clients, which is
+// the same for every solution.
+Cost routeCost(pyvrp::ProblemData const &data,
+               pyvrp::CostEvaluator const &costEvaluator,
+               Route const &route)
+{
+    auto const &vehType = data.vehicleType(route.vehicleType());
+    return route.distanceCost() + route.durationCost() + vehType.fixedCost
+           + costEvaluator.loadPenalty(route.excessLoad(), 0)
+           + costEvaluator.twPenalty(route.timeWarp())
+           + costEvaluator.distPenalty(route.excessDistance(), 0)
+           - route.prizes();
+}
 }  // namespace
 
 pyvrp::Solution pyvrp::crossover::selectiveRouteExchange(
@@ -36,6 +45,19 @@ pyvrp::Solution pyvrp::crossover::selectiveRouteExchange(
     CostEvaluator const &costEvaluator,
     std::pair<size_t, size_t> const &startIndices,
     size_t const numMovedRoutes)
+{
+    auto const routes = selectiveRouteExchangeRoutes(
+        parents, data, costEvaluator, startIndices, numMovedRoutes);
+
+    return {data, routes};
+}
+
+Routes pyvrp::crossover::selectiveRouteExchangeRoutes(
+    std::pair<Solution const *, Solution const *> const &parents,
+    ProblemData const &data,
+    CostEvaluator const &costEvaluator,
+    std::pair<size_t, size_t> const &startIndices,
+    size_t const numMovedRoutes)
 {
     // We create two candidate offsprings, both based on parent A:
     // Let A and B denote the set of customers selected from parents A and B
@@ -180,12 +202,14 @@ pyvrp::Solution pyvrp::crossover::selectiveRouteExchange(
 
     std::vector<Clients> visits1(nRoutesA);
     std::vector<Clients> visits2(nRoutesA);
+    std::vector<Route const *> parentRoutes(nRoutesA);
 
     // Replace selected routes from parent A with routes from parent B
     for (size_t r = 0; r < numMovedRoutes; r++)
     {
         size_t indexA = (startA + r) % nRoutesA;
         size_t indexB = (startB + r) % nRoutesB;
+        parentRoutes[indexA] = &routesB[indexB];
 
         for (Client c : routesB[indexB])
         {
@@ -200,6 +224,7 @@ pyvrp::Solution pyvrp::crossover::selectiveRouteExchange(
     for (size_t r = numMovedRoutes; r < nRoutesA; r++)
     {
         size_t indexA = (startA + r) % nRoutesA;
+        parentRoutes[indexA] = &routesA[indexA];
 
         for (Client c : routesA[indexA])
         {
@@ -210,22 +235,62 @@ pyvrp::Solution pyvrp::crossover::selectiveRouteExchange(
         }
     }
 
-    // Turn visits back into routes.
-    Routes routes1;
-    Routes routes2;
+    // Turn visits back into routes. Routes that are identical to the parent
+    // route they are based on are taken from that parent, without evaluating
+    // them again. New routes are stored in a separate vector, which has room
+    // for all new routes so that pointers into it remain valid.
+    Routes newRoutes;
+    newRoutes.reserve(2 * nRoutesA);
+
+    auto const makeRoute = [&](size_t r, Clients const &visits) -> Route const *
+    {
+        auto const *parent = parentRoutes[r];
+        auto const vehType = routesA[r].vehicleType();
+
+        if (parent->vehicleType() == vehType && parent->visits() == visits)
+            return parent;
+
+        return &newRoutes.emplace_back(data, visits, vehType);
+    };
+
+    // Both offspring share all routes whose visits are the same, so we only
+    // need to evaluate the routes that differ to determine which offspring is
+    // best. Then we return only the routes of that best offspring.
+    std::vector<Route const *> routes1;
+    std::vector<Route const *> routes2;
+    Cost delta = 0;  // penalised cost of offspring 1 minus that of offspring 2
+
     for (size_t r = 0; r < nRoutesA; r++)
     {
+        if (visits1[r] == visits2[r])
+        {
+            if (!visits1[r].empty())
+            {
+                auto const *route = makeRoute(r, visits1[r]);
+                routes1.push_back(route);
+                routes2.push_back(route);
+            }
+
+            continue;
+        }
+
         if (!visits1[r].empty())
-            routes1.emplace_back(data, visits1[r], routesA[r].vehicleType());
+        {
+            routes1.push_back(makeRoute(r, visits1[r]));
+            delta += routeCost(data, costEvaluator, *routes1.back());
+        }
 
         if (!visits2[r].empty())
-            routes2.emplace_back(data, visits2[r], routesA[r].vehicleType());
+        {
+            routes2.push_back(makeRoute(r, visits2[r]));
+            delta -= routeCost(data, costEvaluator, *routes2.back());
+        }
     }
 
-    auto const sol1 = Solution(data, routes1);
-    auto const sol2 = Solution(data, routes2);
+    Routes routes;
+    routes.reserve(nRoutesA);
+    for (auto const *route : delta < 0 ? routes1 : routes2)
+        routes.push_back(*route);
 
-    auto const cost1 = costEvaluator.penalisedCost(sol1);
-    auto const cost2 = costEvaluator.penalisedCost(sol2);
-    return cost1 < cost2 ? sol1 : sol2;
+    return routes;
 }
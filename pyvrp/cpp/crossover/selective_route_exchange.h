@@ -6,6 +6,7 @@
 #include "Solution.h"
 
 #include <utility>
+#include <vector>
 
 namespace pyvrp::crossover
 {
@@ -34,6 +35,19 @@ Solution selectiveRouteExchange(
     CostEvaluator const &costEvaluator,
     std::pair<size_t, size_t> const &startIndices,
     size_t const numMovedRoutes);
+
+/**
+ * Performs SREX like ``selectiveRouteExchange()``, but returns the routes of
+ * the best offspring rather than an offspring solution. These routes can be
+ * passed on to other C++ code, such as the local search, without constructing
+ * an intermediate solution.
+ */
+std::vector<Route> selectiveRouteExchangeRoutes(
+    std::pair<Solution const *, Solution const *> const &parents,
+    ProblemData const &data,
+    CostEvaluator const &costEvaluator,
+    std::pair<size_t, size_t> const &startIndices,
+    size_t const numMovedRoutes);
 }  // namespace pyvrp::crossover
 
 #endif  // PYVRP_CROSSOVER_SELECTIVE_ROUTE_EXCHANGE_H
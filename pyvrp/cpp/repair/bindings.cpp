@@ -1,5 +1,7 @@
 #include "greedy_repair.h"
 #include "nearest_route_insert.h"
+#include "neighbour_repair.h"
+#include "regret_repair.h"
 #include "repair_docs.h"
 
 #include <pybind11/pybind11.h>
@@ -15,7 +17,8 @@ PYBIND11_MODULE(_repair, m)
           py::arg("unplanned"),
           py::arg("data"),
           py::arg("cost_evaluator"),
-          DOC(pyvrp, repair, greedyRepair));
+          DOC(pyvrp, repair, greedyRepair),
+          py::call_guard<py::gil_scoped_release>());
 
     m.def("nearest_route_insert",
           &pyvrp::repair::nearestRouteInsert,
@@ -23,5 +26,26 @@ PYBIND11_MODULE(_repair, m)
           py::arg("unplanned"),
           py::arg("data"),
           py::arg("cost_evaluator"),
-          DOC(pyvrp, repair, nearestRouteInsert));
+          DOC(pyvrp, repair, nearestRouteInsert),
+          py::call_guard<py::gil_scoped_release>());
+
+    m.def("neighbour_repair",
+          &pyvrp::repair::neighbourRepair,
+          py::arg("routes"),
+          py::arg("unplanned"),
+          py::arg("data"),
+          py::arg("cost_evaluator"),
+          py::arg("neighbours"),
+          DOC(pyvrp, repair, neighbourRepair),
+          py::call_guard<py::gil_scoped_release>());
+
+    m.def("regret_repair",
+          &pyvrp::repair::regretRepair,
+          py::arg("routes"),
+          py::arg("unplanned"),
+          py::arg("data"),
+          py::arg("cost_evaluator"),
+          py::arg("num_regret") = 2,
+          DOC(pyvrp, repair, regretRepair),
+          py::call_guard<py::gil_scoped_release>());
 }
@@ -0,0 +1,101 @@
+#include "neighbour_repair.h"
+#include "repair.h"
+
+#include "search/primitives.h"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <stdexcept>
+
+using pyvrp::search::insertCost;
+
+using SearchRoute = pyvrp::search::Route;
+using SolRoute = pyvrp::Route;
+
+std::vector<SolRoute> pyvrp::repair::neighbourRepair(
+    std::vector<SolRoute> const &solRoutes,
+    std::vector<size_t> const &unplanned,
+    ProblemData const &data,
+    CostEvaluator const &costEvaluator,
+    std::vector<std::vector<size_t>> const &neighbours)
+{
+    if (solRoutes.empty() && !unplanned.empty())
+        throw std::invalid_argument("Need routes to repair!");
+
+    if (neighbours.size() != data.numLocations())
+        throw std::invalid_argument("Neighbourhood dimensions do not match.");
+
+    for (auto const &locNeighbours : neighbours)
+        if (std::any_of(locNeighbours.begin(),
+                        locNeighbours.end(),
+                        [&](auto loc) { return loc >= data.numLocations(); }))
+            throw std::invalid_argument("Neighbour is not a valid location.");
+
+    std::vector<SearchRoute::Node> locs;
+    std::vector<SearchRoute> routes;
+    setupRoutes(locs, routes, solRoutes, data);
+
+    // Empty routes of the same vehicle type are interchangeable, so we only
+    // evaluate inserting into the last one of each type. Routes are stored in
+    // reverse order, so that we fill empty routes in their given order.
+    std::vector<std::vector<SearchRoute *>> empty(data.numVehicleTypes());
+    for (auto it = routes.rbegin(); it != routes.rend(); ++it)
+        if (it->empty())
+            empty[it->vehicleType()].push_back(&*it);
+
+    for (auto const client : unplanned)
+    {
+        SearchRoute::Node *U = &locs[client];
+        assert(!U->route());
+
+        SearchRoute::Node *UAfter = nullptr;
+        pyvrp::Cost deltaCost = std::numeric_limits<pyvrp::Cost>::max();
+
+        auto const evaluate = [&](SearchRoute::Node *V)
+        {
+            auto const cost = insertCost(U, V, data, costEvaluator);
+            if (cost < deltaCost)
+            {
+                deltaCost = cost;
+                UAfter = V;
+            }
+        };
+
+        for (auto const &typeEmpty : empty)
+            if (!typeEmpty.empty())
+                evaluate((*typeEmpty.back())[0]);
+
+        for (auto const vClient : neighbours[client])
+        {
+            SearchRoute::Node *V = &locs[vClient];
+            if (!V->route())  // not in a route, or a depot
+                continue;
+
+            evaluate(p(V));  // evaluate before V
+            evaluate(V);     // evaluate after V
+        }
+
+        // There are no planned neighbours and no empty routes, so we
+        // evaluate all moves instead.
+        if (!UAfter)
+        {
+            for (auto &route : routes)
+            {
+                evaluate(route[0]);
+                for (auto *V : route)
+                    evaluate(V);
+            }
+        }
+
+        assert(UAfter && UAfter->route());
+        auto *route = UAfter->route();
+        if (route->empty())
+            empty[route->vehicleType()].pop_back();
+
+        route->insert(UAfter->idx() + 1, U);
+        route->update();
+    }
+
+    return exportRoutes(data, routes);
+}
@@ -0,0 +1,59 @@
+#ifndef PYVRP_REPAIR_NEIGHBOUR_REPAIR_H
+#define PYVRP_REPAIR_NEIGHBOUR_REPAIR_H
+
+#include "CostEvaluator.h"
+#include "ProblemData.h"
+#include "Solution.h"
+
+#include <vector>
+
+namespace pyvrp::repair
+{
+/**
+ * Neighbour repair operator. This operator inserts each client in the list of
+ * unplanned clients into the given routes, like
+ * :func:`~pyvrp.repair._repair.greedy_repair`. Rather than evaluating all
+ * possible moves, it only evaluates inserting the client directly before or
+ * after each of its neighbours that is already in one of the routes, and into
+ * an empty route of each vehicle type. The best such move is applied. This
+ * makes the runtime of each insertion depend on the size of the neighbourhood,
+ * rather than on the number of routes, which is much faster on large
+ * instances.
+ *
+ * When none of the client's neighbours are in the routes, and there are no
+ * empty routes, all possible moves are evaluated instead.
+ *
+ * Parameters
+ * ----------
+ * routes
+ *     List of routes.
+ * unplanned
+ *     Unplanned clients to insert into the routes.
+ * data
+ *     Problem data instance.
+ * cost_evaluator
+ *     Cost evaluator to use when evaluating insertion moves.
+ * neighbours
+ *     Neighbours of each location, for example the granular neighbourhood
+ *     computed by :func:`~pyvrp.search.neighbourhood.compute_neighbours`.
+ *
+ * Returns
+ * -------
+ * list[Route]
+ *     The list of repaired routes.
+ *
+ * Raises
+ * ------
+ * ValueError
+ *     When the list of routes is empty but the list of unplanned clients is
+ *     not, or when the neighbourhood does not match the data instance.
+ */
+std::vector<pyvrp::Route>
+neighbourRepair(std::vector<pyvrp::Route> const &routes,
+                std::vector<size_t> const &unplanned,
+                ProblemData const &data,
+                CostEvaluator const &costEvaluator,
+                std::vector<std::vector<size_t>> const &neighbours);
+}  // namespace pyvrp::repair
+
+#endif  // PYVRP_REPAIR_NEIGHBOUR_REPAIR_H
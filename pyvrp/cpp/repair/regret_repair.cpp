@@ -0,0 +1,121 @@
+#include "regret_repair.h"
+#include "repair.h"
+
+#include "search/RegretCache.h"
+
+#include <algorithm>
+#include <cassert>
+#include <queue>
+#include <stdexcept>
+
+using pyvrp::Cost;
+using pyvrp::search::RegretCache;
+
+using SearchRoute = pyvrp::search::Route;
+using SolRoute = pyvrp::Route;
+
+namespace
+{
+// Priority queue entry. The version identifies whether the entry is still
+// current: each time a client's regret value may have changed, its version is
+// incremented and a new entry is pushed, so that older entries can be skipped.
+struct Entry
+{
+    Cost regret;
+    Cost cost;
+    size_t client;
+    size_t version;
+
+    // Larger regret values go first, then cheaper insertions, and finally
+    // lower client indices.
+    bool operator<(Entry const &other) const
+    {
+        return regret < other.regret
+               || (regret == other.regret && cost > other.cost)
+               || (regret == other.regret && cost == other.cost
+                   && client > other.client);
+    }
+};
+}  // namespace
+
+std::vector<SolRoute>
+pyvrp::repair::regretRepair(std::vector<SolRoute> const &solRoutes,
+                            std::vector<size_t> const &unplanned,
+                            ProblemData const &data,
+                            CostEvaluator const &costEvaluator,
+                            size_t numRegret)
+{
+    if (solRoutes.empty() && !unplanned.empty())
+        throw std::invalid_argument("Need routes to repair!");
+
+    if (numRegret == 0)
+        throw std::invalid_argument("Expected num_regret > 0.");
+
+    std::vector<SearchRoute::Node> locs;
+    std::vector<SearchRoute> routes;
+    setupRoutes(locs, routes, solRoutes, data);
+
+    std::vector<bool> isUnplanned(data.numLocations(), false);
+    for (auto const client : unplanned)
+    {
+        assert(!locs[client].route());
+        isUnplanned[client] = true;
+    }
+
+    // Clients to insert, without duplicates and in ascending order. The cache
+    // and queue identify clients by their index in this list.
+    std::vector<size_t> clients;
+    for (size_t client = 0; client != isUnplanned.size(); ++client)
+        if (isUnplanned[client])
+            clients.push_back(client);
+
+    RegretCache cache(data, costEvaluator, clients.size(), numRegret);
+    std::vector<size_t> versions(clients.size(), 0);
+    std::priority_queue<Entry> queue;
+
+    auto const push = [&](size_t idx)
+    {
+        auto const regret = cache.regret(idx);
+        queue.push({regret, cache.best(idx).cost, idx, ++versions[idx]});
+    };
+
+    // Indices of the clients that have not yet been inserted. The order does
+    // not matter, since the insertion order is determined by the queue.
+    std::vector<size_t> remaining;
+    for (size_t idx = 0; idx != clients.size(); ++idx)
+    {
+        for (auto &route : routes)
+            cache.update(idx, &locs[clients[idx]], route);
+
+        push(idx);
+        remaining.push_back(idx);
+    }
+
+    while (!queue.empty())
+    {
+        auto const entry = queue.top();
+        queue.pop();
+
+        auto const idx = entry.client;
+        if (!isUnplanned[clients[idx]] || entry.version != versions[idx])
+            continue;  // client has been inserted, or entry is outdated
+
+        auto *after = cache.best(idx).after;
+        auto *route = after->route();
+
+        route->insert(after->idx() + 1, &locs[clients[idx]]);
+        route->update();
+
+        isUnplanned[clients[idx]] = false;
+        remaining.erase(std::find(remaining.begin(), remaining.end(), idx));
+
+        // Update the insertion costs into the modified route. The client's
+        // regret value can only change when the modified route was, or now
+        // is, one of its top routes.
+        for (auto const other : remaining)
+            if (cache.update(other, &locs[clients[other]], *route))
+                push(other);
+    }
+
+    return exportRoutes(data, routes);
+}
@@ -0,0 +1,58 @@
+#ifndef PYVRP_REPAIR_REGRET_REPAIR_H
+#define PYVRP_REPAIR_REGRET_REPAIR_H
+
+#include "CostEvaluator.h"
+#include "ProblemData.h"
+#include "Solution.h"
+
+#include <vector>
+
+namespace pyvrp::repair
+{
+/**
+ * Regret repair operator. This operator inserts the clients in the list of
+ * unplanned clients into the given routes, in order of decreasing regret
+ * value. The regret value of a client is the sum of the differences in cost
+ * between its best insertion into each of its best ``num_regret`` routes,
+ * and its best insertion overall. Clients that would be expensive to insert
+ * later, once their best routes have filled up, are thus inserted first. Each
+ * client is inserted at its best position.
+ *
+ * Insertion costs are cached per route and client, and the clients are kept
+ * in a priority queue ordered by regret value. After each insertion, only the
+ * insertion costs into the modified route are recomputed.
+ *
+ * Parameters
+ * ----------
+ * routes
+ *     List of routes.
+ * unplanned
+ *     Unplanned clients to insert into the routes.
+ * data
+ *     Problem data instance.
+ * cost_evaluator
+ *     Cost evaluator to use when evaluating insertion moves.
+ * num_regret
+ *     Number of routes to consider when computing a client's regret value.
+ *     Default 2. With a single route, this operator inserts the client with
+ *     the cheapest insertion first.
+ *
+ * Returns
+ * -------
+ * list[Route]
+ *     The list of repaired routes.
+ *
+ * Raises
+ * ------
+ * ValueError
+ *     When the list of routes is empty but the list of unplanned clients is
+ *     not, or when ``num_regret`` is zero.
+ */
+std::vector<pyvrp::Route> regretRepair(std::vector<pyvrp::Route> const &routes,
+                                       std::vector<size_t> const &unplanned,
+                                       ProblemData const &data,
+                                       CostEvaluator const &costEvaluator,
+                                       size_t numRegret = 2);
+}  // namespace pyvrp::repair
+
+#endif  // PYVRP_REPAIR_REGRET_REPAIR_H
@@ -1,18 +1,70 @@
 #include "LocalSearch.h"
 #include "Measure.h"
+#include "crossover/selective_route_exchange.h"
 #include "primitives.h"
 
 #include <algorithm>
 #include <cassert>
 #include <numeric>
+#include <unordered_map>
 
 using pyvrp::Solution;
 using pyvrp::search::LocalSearch;
+using pyvrp::search::Route;
+
+namespace
+{
+// Mixes the given value into the running hash, hash_combine-style.
+size_t combine(size_t hash, size_t value)
+{
+    return hash ^ (value + 0x9e3779b9 + (hash << 6) + (hash >> 2));
+}
+
+// Hashes the vehicle type and client visits of the given search route.
+size_t hash(Route const &route)
+{
+    auto res = route.vehicleType();
+    for (auto const *node : route)
+        res = combine(res, node->client());
+
+    return res;
+}
+
+// Hashes the vehicle type and client visits of the given solution route. This
+// agrees with the hash of a search route with the same visits.
+size_t hash(pyvrp::Route const &route)
+{
+    auto res = route.vehicleType();
+    for (auto const client : route)
+        res = combine(res, client);
+
+    return res;
+}
+
+// Tests if the given search and solution routes have the same vehicle type
+// and client visits.
+bool equals(Route const &route, pyvrp::Route const &solRoute)
+{
+    return route.vehicleType() == solRoute.vehicleType()
+           && route.size() == solRoute.size()
+           && std::equal(route.begin(),
+                         route.end(),
+                         solRoute.begin(),
+                         [](auto const *node, auto const client)
+                         { return node->client() == client; });
+}
+}  // namespace
 
 Solution LocalSearch::operator()(Solution const &solution,
                                  CostEvaluator const &costEvaluator)
 {
-    loadSolution(solution);
+    return (*this)(solution.routes(), costEvaluator);
+}
+
+Solution LocalSearch::operator()(std::vector<pyvrp::Route> const &routes,
+                                 CostEvaluator const &costEvaluator)
+{
+    loadRoutes(routes, costEvaluator);
 
     while (true)
     {
@@ -26,10 +78,22 @@ Solution LocalSearch::operator()(Solution const &solution,
     return exportSolution();
 }
 
+Solution LocalSearch::srex(
+    std::pair<Solution const *, Solution const *> const &parents,
+    CostEvaluator const &costEvaluator,
+    std::pair<size_t, size_t> const &startIndices,
+    size_t numMovedRoutes)
+{
+    auto const routes = pyvrp::crossover::selectiveRouteExchangeRoutes(
+        parents, data, costEvaluator, startIndices, numMovedRoutes);
+
+    return (*this)(routes, costEvaluator);
+}
+
 Solution LocalSearch::search(Solution const &solution,
                              CostEvaluator const &costEvaluator)
 {
-    loadSolution(solution);
+    loadRoutes(solution.routes(), costEvaluator);
     search(costEvaluator);
     return exportSolution();
 }
@@ -38,7 +102,7 @@ Solution LocalSearch::intensify(Solution const &solution,
                                 CostEvaluator const &costEvaluator,
                                 double overlapTolerance)
 {
-    loadSolution(solution);
+    loadRoutes(solution.routes(), costEvaluator);
     intensify(costEvaluator, overlapTolerance);
     return exportSolution();
 }
@@ -66,6 +130,9 @@ void LocalSearch::search(CostEvaluator const &costEvaluator)
         {
             auto *U = &nodes[uClient];
 
+            if (isFrozen(U))  // then U cannot be moved, so there is nothing
+                continue;     // to be done for this client.
+
             auto const lastTestedNode = lastTestedNodes[uClient];
             lastTestedNodes[uClient] = numMoves;
 
@@ -85,7 +152,7 @@ void LocalSearch::search(CostEvaluator const &costEvaluator)
             {
                 auto *V = &nodes[vClient];
 
-                if (!V->route())
+                if (!V->route() || isFrozen(V))
                     continue;
 
                 if (lastModified[U->route()->idx()] > lastTestedNode
@@ -130,7 +197,7 @@ void LocalSearch::intensify(CostEvaluator const &costEvaluator,
         {
             auto &U = routes[rU];
 
-            if (U.empty())
+            if (U.empty() || frozenUntil[U.idx()] > 0)
                 continue;
 
             auto const lastTested = lastTestedRoutes[U.idx()];
@@ -140,7 +207,8 @@ void LocalSearch::intensify(CostEvaluator const &costEvaluator,
             {
                 auto &V = routes[rV];
 
-                if (V.empty() || !U.overlapsWith(V, overlapTolerance))
+                if (V.empty() || frozenUntil[V.idx()] > 0
+                    || !U.overlapsWith(V, overlapTolerance))
                     continue;
 
                 auto const lastModifiedRoute
@@ -163,6 +231,14 @@ void LocalSearch::shuffle(RandomNumberGenerator &rng)
     std::shuffle(routeOps.begin(), routeOps.end(), rng);
 }
 
+bool LocalSearch::isFrozen(Route::Node const *U) const
+{
+    if (!U->route())
+        return frozen[U->client()];
+
+    return U->idx() <= frozenUntil[U->route()->idx()];
+}
+
 bool LocalSearch::applyNodeOps(Route::Node *U,
                                Route::Node *V,
                                CostEvaluator const &costEvaluator)
@@ -288,6 +364,14 @@ void LocalSearch::applyGroupMoves(Route::Node *U,
         return;
     }
 
+    // Frozen clients must stay where they are, so we cannot change which of
+    // the group's clients are in the solution.
+    auto const isFrozenClient = [&](auto client)
+    { return isFrozen(&nodes[client]); };
+
+    if (std::any_of(inSol.begin(), inSol.end(), isFrozenClient))
+        return;
+
     // We remove clients in order of increasing cost delta (biggest improvement
     // first), and evaluate swapping the last client with U.
     std::vector<Cost> costs;
@@ -329,14 +413,14 @@ void LocalSearch::insert(Route::Node *U,
                          CostEvaluator const &costEvaluator,
                          bool required)
 {
-    Route::Node *UAfter = routes[0][0];
+    Route::Node *UAfter = routes[0][frozenUntil[0]];
     Cost bestCost = insertCost(U, UAfter, data, costEvaluator);
 
     for (auto const vClient : neighbours_[U->client()])
     {
         auto *V = &nodes[vClient];
 
-        if (!V->route())
+        if (!V->route() || isFrozen(V))
             continue;
 
         auto const cost = insertCost(U, V, data, costEvaluator);
@@ -361,6 +445,7 @@ void LocalSearch::update(Route *U, Route *V)
 
     U->update();
     lastModified[U->idx()] = numMoves;
+    loadedFrom[U->idx()] = nullptr;
 
     for (auto *op : routeOps)  // this is used by some route operators
         op->update(U);         // to keep caches in sync.
@@ -369,17 +454,58 @@ void LocalSearch::update(Route *U, Route *V)
     {
         V->update();
         lastModified[V->idx()] = numMoves;
+        loadedFrom[V->idx()] = nullptr;
 
         for (auto *op : routeOps)  // this is used by some route operators
             op->update(V);         // to keep caches in sync.
     }
 }
 
-void LocalSearch::loadSolution(Solution const &solution)
+void LocalSearch::loadRoutes(std::vector<pyvrp::Route> const &solRoutes,
+                             CostEvaluator const &costEvaluator)
 {
-    // First empty all routes.
+    // Index the currently loaded routes by their hash. Routes in the solution
+    // that are already loaded are kept as-is, rather than rebuilt.
+    std::unordered_multimap<size_t, size_t> loaded;
+    for (auto const &route : routes)
+        if (!route.empty())
+            loaded.emplace(hash(route), route.idx());
+
+    std::fill(loadedFrom.begin(), loadedFrom.end(), nullptr);
+
+    std::vector<bool> keep(routes.size(), false);
+    std::vector<pyvrp::Route const *> toLoad;
+    for (auto const &solRoute : solRoutes)
+    {
+        auto const [first, last] = loaded.equal_range(hash(solRoute));
+        auto const it = std::find_if(first,
+                                     last,
+                                     [&](auto const &item)
+                                     {
+                                         auto const idx = item.second;
+                                         return !keep[idx]
+                                                && equals(routes[idx],
+                                                          solRoute);
+                                     });
+
+        if (it == last)
+        {
+            toLoad.push_back(&solRoute);
+            continue;
+        }
+
+        keep[it->second] = true;
+        loadedFrom[it->second] = &solRoute;
+    }
+
+    // Empty all routes that are not kept. These routes have changed.
+    std::vector<Route *> changed;
     for (auto &route : routes)
-        route.clear();
+        if (!keep[route.idx()] && !route.empty())
+        {
+            route.clear();
+            changed.push_back(&route);
+        }
 
     // Determine offsets for vehicle types.
     std::vector<size_t> vehicleOffset(data.numVehicleTypes(), 0);
@@ -389,24 +515,58 @@ void LocalSearch::loadSolution(Solution const &solution)
         vehicleOffset[vehType] = vehicleOffset[vehType - 1] + prevAvail;
     }
 
-    // Load routes from solution.
-    for (auto const &solRoute : solution.routes())
+    // Load remaining routes.
+    for (auto const *solRoute : toLoad)
     {
-        // Determine index of next route of this type to load, where we rely
-        // on solution to be valid to not exceed the number of vehicles per
-        // vehicle type.
-        auto const r = vehicleOffset[solRoute.vehicleType()]++;
+        // Determine index of next empty route of this type to load, where we
+        // rely on the routes to be valid to not exceed the number of vehicles
+        // per vehicle type.
+        auto r = vehicleOffset[solRoute->vehicleType()]++;
+        while (keep[r])
+            r = vehicleOffset[solRoute->vehicleType()]++;
+
         Route &route = routes[r];
 
         assert(route.empty());  // should have been emptied above.
-        for (auto const client : solRoute)
+        for (auto const client : *solRoute)
             route.push_back(&nodes[client]);
 
         route.update();
+        loadedFrom[r] = solRoute;
+
+        if (std::find(changed.begin(), changed.end(), &route) == changed.end())
+            changed.push_back(&route);
+    }
+
+    // Determine the frozen prefix of each route. Moves do not change these
+    // prefixes, so they remain valid until the next solution is loaded.
+    for (auto const &route : routes)
+    {
+        frozenUntil[route.idx()] = 0;
+        for (auto const *node : route)
+            if (frozen[node->client()])
+                frozenUntil[route.idx()] = node->idx();
     }
 
+    // Route operator caches remain valid for the routes we kept, but only if
+    // the cost evaluator has not changed since the previous call, and no other
+    // local search object has used the operator in the meantime.
+    auto const sameCostEvaluator = lastCostEvaluator == costEvaluator;
     for (auto *routeOp : routeOps)
-        routeOp->init(solution);
+    {
+        if (sameCostEvaluator && routeOp->owner == this)
+        {
+            for (auto *route : changed)
+                routeOp->update(route);
+        }
+        else
+        {
+            routeOp->init(solRoutes);
+            routeOp->owner = this;
+        }
+    }
+
+    lastCostEvaluator = costEvaluator;
 }
 
 Solution LocalSearch::exportSolution() const
@@ -419,21 +579,86 @@ Solution LocalSearch::exportSolution() const
         if (route.empty())
             continue;
 
-        std::vector<size_t> visits;
-        visits.reserve(route.size());
+        if (loadedFrom[route.idx()])  // then the route has not been modified
+            solRoutes.push_back(*loadedFrom[route.idx()]);
+        else
+            solRoutes.push_back(exportRoute(route));
+    }
+
+    return {data, solRoutes};
+}
+
+pyvrp::Route LocalSearch::exportRoute(Route const &route) const
+{
+    std::vector<size_t> visits;
+    visits.reserve(route.size());
+
+#ifdef PYVRP_NO_TIME_WINDOWS
+    // Duration segments are not maintained by the search route in this case,
+    // so we have to compute the route's statistics from scratch.
+    for (auto *node : route)
+        visits.push_back(node->client());
 
-        for (auto *node : route)
-            visits.push_back(node->client());
+    return {data, visits, route.vehicleType()};
+#else
+    auto const &durations = data.durationMatrix(route.profile());
 
-        solRoutes.emplace_back(data, visits, route.vehicleType());
+    Duration travel = 0;
+    Duration service = 0;
+    Cost prizes = 0;
+    size_t prev = route.startDepot();
+
+    for (auto *node : route)
+    {
+        auto const client = node->client();
+        ProblemData::Client const &clientData = data.location(client);
+
+        visits.push_back(client);
+        travel += durations(prev, client);
+        service += clientData.serviceDuration;
+        prizes += clientData.prize;
+        prev = client;
     }
 
-    return {data, solRoutes};
+    travel += durations(prev, route.endDepot());
+
+    // The segments ending at the end depot summarise the entire route. These
+    // are exactly what the validating Route constructor would compute.
+    auto const last = route.size() + 1;
+    auto const ds = route.before(last).duration(route.profile());
+    auto const ls = route.before(last).load();
+
+    return {std::move(visits),
+            route.distance(),
+            route.distanceCost(),
+            route.excessDistance(),
+            ls.delivery(),
+            ls.pickup(),
+            route.excessLoad(),
+            route.duration(),
+            route.durationCost(),
+            route.timeWarp(),
+            travel,
+            service,
+            route.duration() - travel - service,
+            ds.releaseTime(),
+            ds.twEarly(),
+            ds.twLate() - ds.twEarly(),
+            prizes,
+            route.centroid(),
+            route.vehicleType(),
+            route.startDepot(),
+            route.endDepot()};
+#endif
 }
 
 void LocalSearch::addNodeOperator(NodeOp &op) { nodeOps.emplace_back(&op); }
 
-void LocalSearch::addRouteOperator(RouteOp &op) { routeOps.emplace_back(&op); }
+void LocalSearch::addRouteOperator(RouteOp &op)
+{
+    routeOps.emplace_back(&op);
+    lastCostEvaluator.reset();  // new operator has not yet been initialised
+}
 
 void LocalSearch::setNeighbours(Neighbours neighbours)
 {
@@ -465,12 +690,37 @@ LocalSearch::Neighbours const &LocalSearch::neighbours() const
     return neighbours_;
 }
 
+void LocalSearch::setFrozenClients(std::vector<size_t> const &clients)
+{
+    for (auto const client : clients)
+        if (client < data.numDepots() || client >= data.numLocations())
+            throw std::invalid_argument("Client index out of range.");
+
+    std::fill(frozen.begin(), frozen.end(), false);
+    for (auto const client : clients)
+        frozen[client] = true;
+}
+
+std::vector<size_t> LocalSearch::frozenClients() const
+{
+    std::vector<size_t> clients;
+    for (size_t client = data.numDepots(); client != data.numLocations();
+         ++client)
+        if (frozen[client])
+            clients.push_back(client);
+
+    return clients;
+}
+
 LocalSearch::LocalSearch(ProblemData const &data, Neighbours neighbours)
     : data(data),
       neighbours_(data.numLocations()),
       orderNodes(data.numClients()),
       orderRoutes(data.numVehicles()),
-      lastModified(data.numVehicles(), -1)
+      lastModified(data.numVehicles(), -1),
+      loadedFrom(data.numVehicles(), nullptr),
+      frozen(data.numLocations(), false),
+      frozenUntil(data.numVehicles(), 0)
 {
     setNeighbours(neighbours);
 
@@ -9,7 +9,9 @@
 #include "Solution.h"
 
 #include <functional>
+#include <optional>
 #include <stdexcept>
+#include <utility>
 #include <vector>
 
 namespace pyvrp::search
@@ -31,6 +33,22 @@ class LocalSearch
 
     std::vector<int> lastModified;  // tracks when routes were last modified
 
+    // Solution route each route was loaded from, or nullptr if the route was
+    // empty at load time or has since been modified. Only valid between calls
+    // to loadRoutes() and exportSolution().
+    std::vector<pyvrp::Route const *> loadedFrom;
+
+    // Cost evaluator used in the previous call, if any. Route operator caches
+    // are only valid for this cost evaluator, so when it changes, those must
+    // be reinitialised when loading the next solution.
+    std::optional<CostEvaluator> lastCostEvaluator;
+
+    // Frozen clients (size numLocations), and for each route the position of
+    // its last frozen client, or 0 if it has none. Moves only change routes
+    // after that position, so each route's frozen prefix is left as-is.
+    std::vector<bool> frozen;
+    std::vector<size_t> frozenUntil;
+
     std::vector<Route::Node> nodes;
     std::vector<Route> routes;
 
@@ -40,12 +58,25 @@ class LocalSearch
     int numMoves = 0;              // Operator counter
     bool searchCompleted = false;  // No further improving move found?
 
-    // Load an initial solution that we will attempt to improve.
-    void loadSolution(Solution const &solution);
+    // Load the routes of an initial solution that we will attempt to improve.
+    // Routes that are already loaded from a previous call are reused, and only
+    // the other routes are rebuilt. The given routes must remain alive until
+    // the solution is exported.
+    void loadRoutes(std::vector<pyvrp::Route> const &solRoutes,
+                    CostEvaluator const &costEvaluator);
 
-    // Export the LS solution back into a solution.
+    // Export the LS solution back into a solution. Routes that have not been
+    // modified since loadRoutes() are copied from the loaded routes, and other
+    // routes are built from the search routes' cached statistics.
     Solution exportSolution() const;
 
+    // Builds a solution route from the cached statistics of the given route.
+    pyvrp::Route exportRoute(Route const &route) const;
+
+    // Tests if the given node is frozen: it is a frozen client, or it is in
+    // the frozen prefix of its route.
+    bool isFrozen(Route::Node const *U) const;
+
     // Tests the node pair (U, V).
     bool applyNodeOps(Route::Node *U,
                       Route::Node *V,
@@ -103,6 +134,21 @@ public:
      */
     Neighbours const &neighbours() const;
 
+    /**
+     * Freezes the given clients, and unfreezes any previously frozen clients.
+     * The search does not move frozen clients, nor clients that are visited
+     * before a frozen client in the same route: the route up to and including
+     * its last frozen client is left as-is. Routes that contain frozen clients
+     * are also skipped by the route operators. Frozen clients that are not in
+     * the solution are not inserted.
+     */
+    void setFrozenClients(std::vector<size_t> const &clients);
+
+    /**
+     * @return The currently frozen clients.
+     */
+    std::vector<size_t> frozenClients() const;
+
     /**
      * Iteratively calls ``search()`` and ``intensify()`` until no further
      * improvements are made.
@@ -110,6 +156,27 @@ public:
     Solution operator()(Solution const &solution,
                         CostEvaluator const &costEvaluator);
 
+    /**
+     * Iteratively calls ``search()`` and ``intensify()`` until no further
+     * improvements are made, starting from a solution consisting of the given
+     * routes. The routes must form a valid solution. This avoids constructing
+     * an intermediate solution when the routes are produced elsewhere in C++,
+     * for example by a crossover operator.
+     */
+    Solution operator()(std::vector<pyvrp::Route> const &routes,
+                        CostEvaluator const &costEvaluator);
+
+    /**
+     * Performs a selective route exchange crossover of the given parents, and
+     * then calls ``operator()`` on the resulting offspring routes. The
+     * offspring routes are loaded directly into the search, without first
+     * constructing an offspring solution.
+     */
+    Solution srex(std::pair<Solution const *, Solution const *> const &parents,
+                  CostEvaluator const &costEvaluator,
+                  std::pair<size_t, size_t> const &startIndices,
+                  size_t numMovedRoutes);
+
     /**
      * Performs regular (node-based) local search around the given solution,
      * and returns a new, hopefully improved solution.
@@ -9,6 +9,8 @@
 
 namespace pyvrp::search
 {
+class LocalSearch;
+
 template <typename Arg> class LocalSearchOperatorBase
 {
     // Can only be specialised into either a Node or Route operator; there
@@ -62,12 +64,24 @@ class LocalSearchOperator<Route> : public LocalSearchOperatorBase<Route>
 {
     using LocalSearchOperatorBase::LocalSearchOperatorBase;
 
+    // The local search that most recently initialised or updated this
+    // operator's state. Another local search object that shares this operator
+    // cannot rely on that state, and must re-initialise it first.
+    friend class LocalSearch;
+    LocalSearch const *owner = nullptr;
+
 public:
     /**
-     * Called once after loading in the solution to improve. This can be used
-     * to e.g. update local operator state.
+     * Called after loading in the routes of the solution to improve, when the
+     * local search could not reuse the state of its previous call (for
+     * example, because the cost evaluator changed, or because another local
+     * search object used this operator in the meantime). This can be used to
+     * e.g. reset local operator state. Otherwise, only the routes that changed
+     * since the previous call are passed to ``update()``.
      */
-    virtual void init([[maybe_unused]] Solution const &solution) {};
+    virtual void init([[maybe_unused]] std::vector<pyvrp::Route> const &routes)
+    {
+    }
 
     /**
      * Called when a route has been changed. Can be used to update caches, but
@@ -0,0 +1,107 @@
+#include "RegretCache.h"
+#include "primitives.h"
+
+#include <algorithm>
+#include <cassert>
+
+using pyvrp::Cost;
+using pyvrp::search::RegretCache;
+
+RegretCache::RegretCache(ProblemData const &data,
+                         CostEvaluator const &costEvaluator,
+                         size_t numClients,
+                         size_t numRegret)
+    : data(data),
+      costEvaluator(costEvaluator),
+      numRegret(numRegret),
+      insertions(numClients),
+      top(numClients)
+{
+}
+
+void RegretCache::place(size_t client, size_t route)
+{
+    auto const &clientInsertions = insertions[client];
+    auto &clientTop = top[client];
+
+    clientTop.erase(std::remove(clientTop.begin(), clientTop.end(), route),
+                    clientTop.end());
+
+    // Routes with equal insertion costs are ordered by index, so that the top
+    // routes do not depend on the order in which the routes were updated.
+    auto const pos = std::upper_bound(
+        clientTop.begin(),
+        clientTop.end(),
+        route,
+        [&](auto const lhs, auto const rhs)
+        {
+            auto const lhsCost = clientInsertions[lhs].cost;
+            auto const rhsCost = clientInsertions[rhs].cost;
+            return lhsCost < rhsCost || (lhsCost == rhsCost && lhs < rhs);
+        });
+
+    clientTop.insert(pos, route);
+    if (clientTop.size() > numRegret)
+        clientTop.pop_back();
+}
+
+RegretCache::Insertion const &RegretCache::insertion(size_t client,
+                                                     size_t route) const
+{
+    return insertions[client][route];
+}
+
+RegretCache::Insertion const &RegretCache::best(size_t client) const
+{
+    assert(!top[client].empty());
+    return insertions[client][top[client][0]];
+}
+
+Cost RegretCache::regret(size_t client) const
+{
+    auto const minCost = best(client).cost;
+
+    Cost regret = 0;
+    for (auto const route : top[client])
+        regret += insertions[client][route].cost - minCost;
+
+    return regret;
+}
+
+bool RegretCache::update(size_t client, Route::Node *U, Route &route)
+{
+    auto &clientInsertions = insertions[client];
+    if (route.idx() >= clientInsertions.size())
+        clientInsertions.resize(route.idx() + 1);
+
+    auto const prevCost = clientInsertions[route.idx()].cost;
+
+    Insertion best = {insertCost(U, route[0], data, costEvaluator), route[0]};
+    for (auto *V : route)
+    {
+        auto const cost = insertCost(U, V, data, costEvaluator);
+        if (cost < best.cost)
+            best = {cost, V};
+    }
+
+    clientInsertions[route.idx()] = best;
+
+    auto &clientTop = top[client];
+    auto const isTop = [&]()
+    {
+        return std::find(clientTop.begin(), clientTop.end(), route.idx())
+               != clientTop.end();
+    };
+
+    auto const wasTop = isTop();
+    if (!wasTop || best.cost <= prevCost)
+        place(client, route.idx());
+    else
+    {
+        clientTop.clear();
+        for (size_t other = 0; other != clientInsertions.size(); ++other)
+            place(client, other);
+    }
+
+    return wasTop || isTop();
+}
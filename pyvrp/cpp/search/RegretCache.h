@@ -0,0 +1,74 @@
+#ifndef PYVRP_SEARCH_REGRETCACHE_H
+#define PYVRP_SEARCH_REGRETCACHE_H
+
+#include "CostEvaluator.h"
+#include "Measure.h"
+#include "ProblemData.h"
+#include "Route.h"
+
+#include <vector>
+
+namespace pyvrp::search
+{
+// Caches the best insertion of a number of clients into each route, and for
+// each client the (at most) numRegret routes with the cheapest such
+// insertions, in ascending order of cost, and then of route index. Clients are identified by their
+// index in the list of clients that are to be inserted, so the cache's size
+// does not depend on the size of the instance. Routes are identified by their
+// index, and may be added at any time by updating a client's insertion into
+// the new route.
+//
+// This is used by regret-based insertion heuristics, which repeatedly insert
+// the client with the largest regret value. Regret values only change when a
+// route is modified, so only the insertions into that route need to be
+// updated afterwards.
+class RegretCache
+{
+public:
+    // Best insertion of a client into a route: directly after the given node.
+    struct Insertion
+    {
+        Cost cost = 0;
+        Route::Node *after = nullptr;
+    };
+
+private:
+    ProblemData const &data;
+    CostEvaluator const &costEvaluator;
+    size_t const numRegret;
+
+    std::vector<std::vector<Insertion>> insertions;  // client -> route
+    std::vector<std::vector<size_t>> top;            // client -> routes
+
+    // Places the route in the client's top routes, if its insertion cost is
+    // small enough, and removes it from the top routes otherwise.
+    void place(size_t client, size_t route);
+
+public:
+    RegretCache(ProblemData const &data,
+                CostEvaluator const &costEvaluator,
+                size_t numClients,
+                size_t numRegret);
+
+    // Best insertion of the client into the given route.
+    [[nodiscard]] Insertion const &insertion(size_t client,
+                                             size_t route) const;
+
+    // Cheapest insertion of the client over all routes.
+    [[nodiscard]] Insertion const &best(size_t client) const;
+
+    // Regret value of the client: the sum of the differences between the
+    // insertion costs into its top routes, and the cheapest of those.
+    [[nodiscard]] Cost regret(size_t client) const;
+
+    // Evaluates inserting the client, represented by node U, into the given
+    // route, and updates the client's top routes. When the cost of one of
+    // those top routes increases, some other route may now be better, so all
+    // routes are considered again. Returns whether the client's regret value
+    // may have changed, which is the case when the route was, or now is, one
+    // of the client's top routes.
+    bool update(size_t client, Route::Node *U, Route &route);
+};
+}  // namespace pyvrp::search
+
+#endif  // PYVRP_SEARCH_REGRETCACHE_H
@@ -136,9 +136,9 @@ Cost SwapStar::evaluateMove(Route::Node const *U,
     return deltaCost;
 }
 
-void SwapStar::init(Solution const &solution)
+void SwapStar::init(std::vector<pyvrp::Route> const &routes)
 {
-    LocalSearchOperator<Route>::init(solution);
+    LocalSearchOperator<Route>::init(routes);
     std::fill(updated.begin(), updated.end(), true);
 }
 
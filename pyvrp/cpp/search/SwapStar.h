@@ -77,7 +77,7 @@ class SwapStar : public LocalSearchOperator<Route>
                       CostEvaluator const &costEvaluator) const;
 
 public:
-    void init(Solution const &solution) override;
+    void init(std::vector<pyvrp::Route> const &routes) override;
 
     Cost
     evaluate(Route *U, Route *V, CostEvaluator const &costEvaluator) override;
@@ -0,0 +1,143 @@
+from __future__ import annotations
+
+from functools import partial
+from typing import TYPE_CHECKING, Callable, Optional, Sequence
+
+from pyvrp.crossover._crossover import OperatorSelector
+from pyvrp.crossover.selective_route_exchange import selective_route_exchange
+
+if TYPE_CHECKING:
+    from pyvrp._pyvrp import (
+        CostEvaluator,
+        ProblemData,
+        RandomNumberGenerator,
+        Solution,
+    )
+
+    CrossoverOperator = Callable[
+        [
+            tuple[Solution, Solution],
+            ProblemData,
+            CostEvaluator,
+            RandomNumberGenerator,
+        ],
+        Solution,
+    ]
+
+
+class AdaptiveCrossover:
+    """
+    Crossover operator that adaptively selects one of the given crossover
+    operators for each offspring. Selection uses an upper confidence bound
+    bandit policy on the improvement each operator obtains per unit of time,
+    so that the operators that pay off on the instance being solved are
+    selected more often. See :class:`~pyvrp.crossover.OperatorSelector` for
+    details.
+
+    The :class:`~pyvrp.GeneticAlgorithm.GeneticAlgorithm` reports the
+    improvement and time spent for each offspring back to this operator via
+    :meth:`~update`.
+
+    Parameters
+    ----------
+    operators
+        Crossover operators to select from.
+    exploration
+        Exploration weight of the bandit policy. Larger values favour operators
+        that have been tried less often. Default 1.
+
+    Raises
+    ------
+    ValueError
+        When no operators are given, or ``exploration`` is negative.
+    """
+
+    def __init__(
+        self,
+        operators: Sequence[CrossoverOperator],
+        exploration: float = 1.0,
+    ):
+        self._operators = list(operators)
+        self._selector = OperatorSelector(len(self._operators), exploration)
+        self._last: Optional[int] = None
+
+    @classmethod
+    def srex_variants(
+        cls,
+        max_moved_routes: int = 3,
+        exploration: float = 1.0,
+    ) -> AdaptiveCrossover:
+        """
+        Creates an adaptive crossover operator that selects between variants
+        of :func:`~pyvrp.crossover.selective_route_exchange`. Each variant
+        exchanges a fixed number of routes between one and
+        ``max_moved_routes``, with either aligned or independently selected
+        random start indices.
+
+        Parameters
+        ----------
+        max_moved_routes
+            Maximum number of routes exchanged by any of the variants.
+        exploration
+            Exploration weight of the bandit policy.
+
+        Raises
+        ------
+        ValueError
+            When ``max_moved_routes`` is not positive.
+        """
+        if max_moved_routes <= 0:
+            raise ValueError("Expected max_moved_routes > 0.")
+
+        operators = [
+            partial(
+                selective_route_exchange,
+                num_moved_routes=num_moved,
+                aligned_start=aligned_start,
+            )
+            for num_moved in range(1, max_moved_routes + 1)
+            for aligned_start in (True, False)
+        ]
+
+        return cls(operators, exploration)
+
+    @property
+    def selector(self) -> OperatorSelector:
+        """
+        Returns the operator selector, which tracks statistics about each of
+        the operators.
+        """
+        return self._selector
+
+    def __call__(
+        self,
+        parents: tuple[Solution, Solution],
+        data: ProblemData,
+        cost_evaluator: CostEvaluator,
+        rng: RandomNumberGenerator,
+    ) -> Solution:
+        self._last = self._selector.select()
+        operator = self._operators[self._last]
+        return operator(parents, data, cost_evaluator, rng)
+
+    def update(self, improvement: float, duration: float):
+        """
+        Updates the statistics of the most recently applied operator.
+
+        Parameters
+        ----------
+        improvement
+            Improvement obtained from the most recent offspring, for example
+            compared to the best of its parents.
+        duration
+            Time spent on creating and improving the most recent offspring.
+
+        Raises
+        ------
+        ValueError
+            When no operator has been applied yet.
+        """
+        if self._last is None:
+            raise ValueError("No operator has been applied yet.")
+
+        self._selector.update(self._last, improvement, duration)
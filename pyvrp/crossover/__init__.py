@@ -1,4 +1,8 @@
+from .AdaptiveCrossover import AdaptiveCrossover as AdaptiveCrossover
+from ._crossover import OperatorSelector as OperatorSelector
+from .giant_tour_crossover import giant_tour_crossover as giant_tour_crossover
 from .ordered_crossover import ordered_crossover as ordered_crossover
+from .selective_route_exchange import select_routes as select_routes
 from .selective_route_exchange import (
     selective_route_exchange as selective_route_exchange,
 )
@@ -1,5 +1,22 @@
 from pyvrp import CostEvaluator, ProblemData, Solution
 
+class OperatorSelector:
+    def __init__(
+        self, num_operators: int, exploration: float = 1.0
+    ) -> None: ...
+    def select(self) -> int: ...
+    def update(self, op: int, improvement: float, duration: float) -> None: ...
+    def num_operators(self) -> int: ...
+    def num_updates(self) -> list[int]: ...
+    def improvements(self) -> list[float]: ...
+    def durations(self) -> list[float]: ...
+
+def giant_tour_crossover(
+    parents: tuple[Solution, Solution],
+    data: ProblemData,
+    cost_evaluator: CostEvaluator,
+    indices: tuple[int, int],
+) -> Solution: ...
 def ordered_crossover(
     parents: tuple[Solution, Solution],
     data: ProblemData,
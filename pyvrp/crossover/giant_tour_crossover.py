@@ -0,0 +1,73 @@
+from pyvrp._pyvrp import (
+    CostEvaluator,
+    ProblemData,
+    RandomNumberGenerator,
+    Solution,
+)
+from pyvrp.crossover._crossover import giant_tour_crossover as _gtx
+
+
+def giant_tour_crossover(
+    parents: tuple[Solution, Solution],
+    data: ProblemData,
+    cost_evaluator: CostEvaluator,
+    rng: RandomNumberGenerator,
+) -> Solution:
+    """
+    Performs an ordered crossover (OX) operation on the giant tours of the two
+    given parents. The giant tour of a solution concatenates its routes, in
+    order of their polar angle with respect to the centroid of all clients.
+    The clients between two randomly selected indices of the first giant tour
+    are copied into a new giant tour, and any missing clients that are present
+    in the second giant tour are then copied in as well. The resulting giant
+    tour is then split into routes, as in [1]_.
+
+    Splitting determines where the giant tour is cut into routes, and which
+    vehicle type serves each route, such that the penalised cost of the routes
+    is minimal. This split respects the number of available vehicles of each
+    vehicle type. Unlike :func:`~pyvrp.crossover.ordered_crossover`, this
+    operator thus works for instances with multiple vehicles.
+
+    Parameters
+    ----------
+    parents
+        The two parent solutions to create an offspring from.
+    data
+        The problem instance.
+    cost_evaluator
+        The cost evaluator used to split the offspring's giant tour.
+    rng
+        The random number generator to use.
+
+    Returns
+    -------
+    Solution
+        A new offspring.
+
+    References
+    ----------
+    .. [1] C. Prins. 2004. A simple and effective evolutionary algorithm for
+           the vehicle routing problem. *Computers & Operations Research*,
+           31(12): 1985 - 2002.
+    """
+    first, second = parents
+
+    if first.num_clients() == 0:
+        return second
+
+    if second.num_clients() == 0:
+        return first
+
+    # Generate [start, end) indices in the giant tour of the first parent
+    # solution. If end < start, the index segment wraps around. Clients in this
+    # index segment are copied verbatim into the offspring's giant tour.
+    num_clients = first.num_clients()
+    start = rng.randint(num_clients)
+    end = rng.randint(num_clients)
+
+    # When start == end we try to find a different end index, such that the
+    # offspring actually inherits something from each parent.
+    while start == end and num_clients > 1:
+        end = rng.randint(num_clients)
+
+    return _gtx(parents, data, cost_evaluator, (start, end))
@@ -1,3 +1,4 @@
+from typing import Optional
 from warnings import warn
 
 from pyvrp._pyvrp import (
@@ -15,6 +16,8 @@ def selective_route_exchange(
     data: ProblemData,
     cost_evaluator: CostEvaluator,
     rng: RandomNumberGenerator,
+    num_moved_routes: Optional[int] = None,
+    aligned_start: bool = True,
 ) -> Solution:
     """
     The selective route exchange crossover (SREX) operator due to Nagata and
@@ -41,6 +44,14 @@ def selective_route_exchange(
         The cost evaluator used to evaluate the offspring.
     rng
         The random number generator to use.
+    num_moved_routes
+        Number of routes to exchange. This is capped at the number of routes of
+        either parent. If not provided, the number of routes to exchange is
+        selected uniformly at random.
+    aligned_start
+        Whether the routes selected from the second parent start at the same
+        index as those selected from the first parent (default), or at an
+        independently selected random index.
 
     Returns
     -------
@@ -69,11 +80,59 @@ def selective_route_exchange(
     if second.num_clients() == 0:
         return first
 
+    indices, num_routes = select_routes(
+        parents, rng, num_moved_routes, aligned_start
+    )
+
+    return _srex(parents, data, cost_evaluator, indices, num_routes)
+
+
+def select_routes(
+    parents: tuple[Solution, Solution],
+    rng: RandomNumberGenerator,
+    num_moved_routes: Optional[int] = None,
+    aligned_start: bool = True,
+) -> tuple[tuple[int, int], int]:
+    """
+    Randomly selects the routes that :func:`selective_route_exchange`
+    exchanges between the given parents. This is useful for methods that
+    perform the exchange themselves, such as
+    :meth:`~pyvrp.search.LocalSearch.LocalSearch.srex`.
+
+    Parameters
+    ----------
+    parents
+        The two parent solutions. Both parents must have at least one route.
+    rng
+        The random number generator to use.
+    num_moved_routes
+        Number of routes to exchange. This is capped at the number of routes of
+        either parent. If not provided, the number of routes to exchange is
+        selected uniformly at random.
+    aligned_start
+        Whether the routes selected from the second parent start at the same
+        index as those selected from the first parent (default), or at an
+        independently selected random index.
+
+    Returns
+    -------
+    tuple[tuple[int, int], int]
+        The start indices of the exchanged routes in the first and second
+        parent, and the number of routes to exchange.
+    """
+    first, second = parents
     idx1 = rng.randint(first.num_routes())
-    idx2 = idx1 if idx1 < second.num_routes() else 0
+
+    if aligned_start:
+        idx2 = idx1 if idx1 < second.num_routes() else 0
+    else:
+        idx2 = rng.randint(second.num_routes())
+
     max_routes_to_move = min(first.num_routes(), second.num_routes())
-    num_routes_to_move = rng.randint(max_routes_to_move) + 1
 
-    return _srex(
-        parents, data, cost_evaluator, (idx1, idx2), num_routes_to_move
-    )
+    if num_moved_routes is None:
+        num_routes_to_move = rng.randint(max_routes_to_move) + 1
+    else:
+        num_routes_to_move = min(num_moved_routes, max_routes_to_move)
+
+    return (idx1, idx2), num_routes_to_move
@@ -1,2 +1,4 @@
 from ._repair import greedy_repair as greedy_repair
 from ._repair import nearest_route_insert as nearest_route_insert
+from ._repair import neighbour_repair as neighbour_repair
+from ._repair import regret_repair as regret_repair
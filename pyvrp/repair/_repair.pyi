@@ -12,3 +12,17 @@ def nearest_route_insert(
     data: ProblemData,
     cost_evaluator: CostEvaluator,
 ) -> list[Route]: ...
+def neighbour_repair(
+    routes: list[Route],
+    unplanned: list[int],
+    data: ProblemData,
+    cost_evaluator: CostEvaluator,
+    neighbours: list[list[int]],
+) -> list[Route]: ...
+def regret_repair(
+    routes: list[Route],
+    unplanned: list[int],
+    data: ProblemData,
+    cost_evaluator: CostEvaluator,
+    num_regret: int = 2,
+) -> list[Route]: ...
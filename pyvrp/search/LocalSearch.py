@@ -1,9 +1,12 @@
+from typing import Optional
+
 from pyvrp._pyvrp import (
     CostEvaluator,
     ProblemData,
     RandomNumberGenerator,
     Solution,
 )
+from pyvrp.crossover import select_routes
 from pyvrp.search._search import LocalSearch as _LocalSearch
 from pyvrp.search._search import NodeOperator, RouteOperator
 
@@ -22,6 +25,16 @@ class LocalSearch:
         Random number generator.
     neighbours
         List of lists that defines the local search neighbourhood.
+
+    .. note::
+
+       The search releases the GIL while it runs, so different local search
+       objects can improve solutions concurrently from multiple threads. They
+       may share the same data and cost evaluator, since those are only read.
+       A single local search object, its operators, and its random number
+       generator should however not be used by multiple threads at the same
+       time. This includes route operators that are shared between local
+       search objects: see :meth:`~add_route_operator`.
     """
 
     def __init__(
@@ -51,6 +64,13 @@ class LocalSearch:
         will be used by :meth:`~intensify` to improve a solution using more
         expensive route operators.
 
+        .. note::
+
+           Route operators cache state between calls. Sharing a route operator
+           between local search objects is allowed, but forces the operator to
+           re-initialise whenever it switches between those objects. Prefer
+           giving each local search object its own route operators.
+
         Parameters
         ----------
         op
@@ -76,6 +96,34 @@ class LocalSearch:
         """
         return self._ls.neighbours()
 
+    def set_frozen_clients(self, clients: list[int]):
+        """
+        Freezes the given clients, for example because they have already been
+        dispatched. The search does not move frozen clients, nor any clients
+        that are visited before a frozen client in the same route. A route's
+        visits up to and including its last frozen client thus remain as they
+        are, and the search only changes the part of the route after it. Route
+        operators skip routes with frozen clients altogether. Any previously
+        frozen clients are unfrozen.
+
+        Parameters
+        ----------
+        clients
+            Clients to freeze. Pass an empty list to unfreeze all clients.
+
+        Raises
+        ------
+        ValueError
+            When any of the given clients is not a valid client index.
+        """
+        self._ls.set_frozen_clients(clients)
+
+    def frozen_clients(self) -> list[int]:
+        """
+        Returns the clients that are currently frozen.
+        """
+        return self._ls.frozen_clients()
+
     def __call__(
         self,
         solution: Solution,
@@ -104,6 +152,54 @@ class LocalSearch:
         self._ls.shuffle(self._rng)
         return self._ls(solution, cost_evaluator)
 
+    def srex(
+        self,
+        parents: tuple[Solution, Solution],
+        cost_evaluator: CostEvaluator,
+        num_moved_routes: Optional[int] = None,
+        aligned_start: bool = True,
+    ) -> Solution:
+        """
+        Performs a selective route exchange crossover of the given parents,
+        and improves the resulting offspring like :meth:`~__call__`. This is
+        equivalent to calling this search method on the offspring returned by
+        :func:`~pyvrp.crossover.selective_route_exchange`, but faster: the
+        offspring routes are loaded directly into the search, without first
+        constructing an offspring solution.
+
+        Parameters
+        ----------
+        parents
+            The two parent solutions to create an offspring from.
+        cost_evaluator
+            Cost evaluator to use.
+        num_moved_routes
+            Number of routes to exchange. See
+            :func:`~pyvrp.crossover.selective_route_exchange` for details.
+        aligned_start
+            Whether to align the start indices of the exchanged routes. See
+            :func:`~pyvrp.crossover.selective_route_exchange` for details.
+
+        Returns
+        -------
+        Solution
+            The improved offspring solution.
+        """
+        first, second = parents
+
+        if first.num_clients() == 0:
+            return self(second, cost_evaluator)
+
+        if second.num_clients() == 0:
+            return self(first, cost_evaluator)
+
+        indices, num_routes = select_routes(
+            parents, self._rng, num_moved_routes, aligned_start
+        )
+
+        self._ls.shuffle(self._rng)
+        return self._ls.srex(parents, cost_evaluator, indices, num_routes)
+
     def intensify(
         self,
         solution: Solution,
@@ -18,6 +18,7 @@ from ._search import SwapStar as SwapStar
 from ._search import SwapTails as SwapTails
 from .neighbourhood import NeighbourhoodParams as NeighbourhoodParams
 from .neighbourhood import compute_neighbours as compute_neighbours
+from .neighbourhood import extend_neighbours as extend_neighbours
 
 NODE_OPERATORS: list[Type[NodeOperator]] = [
     Exchange10,
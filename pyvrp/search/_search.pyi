@@ -47,11 +47,20 @@ class LocalSearch:
     def add_route_operator(self, op: RouteOperator) -> None: ...
     def set_neighbours(self, neighbours: list[list[int]]) -> None: ...
     def neighbours(self) -> list[list[int]]: ...
+    def set_frozen_clients(self, clients: list[int]) -> None: ...
+    def frozen_clients(self) -> list[int]: ...
     def __call__(
         self,
         solution: Solution,
         cost_evaluator: CostEvaluator,
     ) -> Solution: ...
+    def srex(
+        self,
+        parents: tuple[Solution, Solution],
+        cost_evaluator: CostEvaluator,
+        start_indices: tuple[int, int],
+        num_moved_routes: int,
+    ) -> Solution: ...
     def shuffle(self, rng: RandomNumberGenerator) -> None: ...
     def intensify(
         self,
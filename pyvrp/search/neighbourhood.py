@@ -1,7 +1,7 @@
 from __future__ import annotations
 
 from dataclasses import dataclass
-from typing import TYPE_CHECKING
+from typing import TYPE_CHECKING, Optional
 
 import numpy as np
 
@@ -112,8 +112,133 @@ def compute_neighbours(
     return [np.flatnonzero(row).tolist() for row in adj]
 
 
+def extend_neighbours(
+    data: ProblemData,
+    neighbours: list[list[int]],
+    params: NeighbourhoodParams = NeighbourhoodParams(),
+) -> list[list[int]]:
+    """
+    Extends a neighbourhood that was computed for an earlier version of the
+    given problem instance, before new clients were appended to it. This is
+    useful when new clients arrive while a search is running: only the
+    proximity between the new clients and the other clients is computed, which
+    takes :math:`O(nm)` time for :math:`m` new clients rather than the
+    :math:`O(n^2)` time needed to recompute the full neighbourhood.
+
+    .. note::
+
+       The new clients must have been appended after the existing clients,
+       and the data of the existing clients must not have changed. When
+       ``params.symmetric_neighbours`` is set, adding a client may also remove
+       neighbours of existing clients, and the neighbourhood is recomputed
+       from scratch instead.
+
+    Parameters
+    ----------
+    data
+        ProblemData for which to compute the neighbourhood. This instance
+        should contain the clients of the earlier instance, followed by the
+        new clients.
+    neighbours
+        Neighbourhood of the earlier instance, as computed by
+        :func:`~compute_neighbours` using the same ``params``.
+    params
+        NeighbourhoodParams that define how the neighbourhood is computed.
+
+    Returns
+    -------
+    list
+        The neighbourhood for the given problem instance. This is the same
+        neighbourhood as returned by :func:`~compute_neighbours`.
+
+    Raises
+    ------
+    ValueError
+        When the given neighbourhood has more locations than the given data
+        instance, or fewer locations than the instance has depots.
+    """
+    num_old = len(neighbours)
+    if not data.num_depots <= num_old <= data.num_locations:
+        raise ValueError("Neighbourhood does not match data instance.")
+
+    if params.symmetric_neighbours:
+        return compute_neighbours(data, params)
+
+    k = min(params.nb_granular, data.num_clients - 1)  # excl. self
+    clients = np.arange(data.num_depots, data.num_locations)
+    old = np.arange(data.num_depots, num_old)
+    new = np.arange(num_old, data.num_locations)
+
+    # The new clients do not have any neighbours yet, so we compute their
+    # neighbourhoods in full, like compute_neighbours does.
+    prox = _pairwise_proximity(data, params, new[:, None], clients[None, :])
+    prox[new - num_old, new - data.num_depots] = np.inf  # not own neighbour
+    top_k = np.argsort(prox, axis=1, kind="stable")[:, :k]
+    new_neighbours = clients[top_k].tolist()
+
+    # An existing client's new neighbours are the best of its old neighbours
+    # and the new clients. Its old neighbours are already sorted by proximity
+    # (and then index), and all new clients have larger indices, so a stable
+    # sort results in the same tie-breaking as in compute_neighbours.
+    old_neighbours: list[list[int]] = []
+    if len(old) > 0:
+        curr = np.array(neighbours[data.num_depots :], dtype=int)
+        curr = curr.reshape(len(old), -1)
+        cands = np.hstack([curr, np.broadcast_to(new, (len(old), len(new)))])
+
+        prox = _pairwise_proximity(data, params, old[:, None], cands)
+        order = np.argsort(prox, axis=1, kind="stable")[:, :k]
+        old_neighbours = np.take_along_axis(cands, order, axis=1).tolist()
+
+    depots: list[list[int]] = [[] for _ in range(data.num_depots)]
+    return depots + old_neighbours + new_neighbours
+
+
+def _pairwise_proximity(
+    data: ProblemData,
+    params: NeighbourhoodParams,
+    frm: np.ndarray[int],
+    to: np.ndarray[int],
+) -> np.ndarray[float]:
+    """
+    Computes the proximity between each pair of clients in the (broadcasted)
+    ``frm`` and ``to`` index arrays, in the same way as compute_neighbours.
+    """
+    proximity = _compute_proximity(
+        data,
+        params.weight_wait_time,
+        params.weight_time_warp,
+        frm,
+        to,
+    )
+
+    if params.symmetric_proximity:
+        reverse = _compute_proximity(
+            data,
+            params.weight_wait_time,
+            params.weight_time_warp,
+            to,
+            frm,
+        )
+
+        proximity = np.minimum(proximity, reverse)
+
+    groups = np.full(data.num_locations, -1)
+    for idx, group in enumerate(data.groups()):
+        if group.mutually_exclusive:
+            groups[group.clients] = idx
+
+    same_group = (groups[frm] == groups[to]) & (groups[frm] >= 0)
+    proximity[same_group] = np.finfo(np.float64).max
+    return proximity
+
+
 def _compute_proximity(
-    data: ProblemData, weight_wait_time: float, weight_time_warp: float
+    data: ProblemData,
+    weight_wait_time: float,
+    weight_time_warp: float,
+    frm: Optional[np.ndarray[int]] = None,
+    to: Optional[np.ndarray[int]] = None,
 ) -> np.ndarray[float]:
     """
     Computes proximity for neighborhood. Proximity is based on [1]_, with
@@ -123,14 +248,23 @@ def _compute_proximity(
     ----------
     data
         ProblemData for which to compute proximity.
-    params
-        NeighbourhoodParams that define how proximity is computed.
+    weight_wait_time
+        Penalty weight given to the minimum wait time.
+    weight_time_warp
+        Penalty weight given to the minimum time warp.
+    frm
+        Optional index array of locations to compute the proximity from. Must
+        be broadcastable against ``to``. If not provided, the proximity is
+        computed between all pairs of locations.
+    to
+        Optional index array of locations to compute the proximity to.
 
     Returns
     -------
     np.ndarray[float]
         An array of size :py:attr:`~pyvrp._pyvrp.ProblemData.num_locations`
-        by :py:attr:`~pyvrp._pyvrp.ProblemData.num_locations`.
+        by :py:attr:`~pyvrp._pyvrp.ProblemData.num_locations`, or of the
+        broadcasted shape of ``frm`` and ``to`` if those are provided.
 
     References
     ----------
@@ -139,6 +273,10 @@ def _compute_proximity(
            large class of vehicle routing problems with time-windows.
            *Computers & Operations Research*, 40(1), 475 - 489.
     """
+    if frm is None or to is None:
+        frm = np.arange(data.num_locations)[:, None]
+        to = np.arange(data.num_locations)[None, :]
+
     early = np.zeros((data.num_locations,))
     early[data.num_depots :] = np.asarray([c.tw_early for c in data.clients()])
 
@@ -153,8 +291,8 @@ def _compute_proximity(
 
     # We first determine the elementwise minimum cost across all vehicle types.
     # This is the cheapest way any edge can be traversed.
-    distances = data.distance_matrices()
-    durations = data.duration_matrices()
+    distances = [mat[frm, to] for mat in data.distance_matrices()]
+    durations = [mat[frm, to] for mat in data.duration_matrices()]
     edge_costs = [  # edge costs per vehicle type
         veh_type.unit_distance_cost * distances[veh_type.profile]
         + veh_type.unit_duration_cost * durations[veh_type.profile]
@@ -163,14 +301,14 @@ def _compute_proximity(
 
     # Minimum wait time and time warp of visiting j directly after i.
     min_duration = np.minimum.reduce(durations)
-    min_wait = early[None, :] - min_duration - service[:, None] - late[:, None]
-    min_tw = early[:, None] + service[:, None] + min_duration - late[None, :]
+    min_wait = early[to] - min_duration - service[frm] - late[frm]
+    min_tw = early[frm] + service[frm] + min_duration - late[to]
 
     # Proximity is based on edge costs (and rewards) and penalties for known
     # time-related violations.
     return (
         np.minimum.reduce(edge_costs, dtype=float)
-        - prize[None, :]
+        - prize[to]
         + weight_wait_time * np.maximum(min_wait, 0)
         + weight_time_warp * np.maximum(min_tw, 0)
     )
@@ -1,17 +1,30 @@
 from __future__ import annotations
 
-from typing import TYPE_CHECKING, Type, Union
+from collections import Counter
+from concurrent.futures import Future, ThreadPoolExecutor
+from copy import deepcopy
+from queue import SimpleQueue
+from typing import TYPE_CHECKING, Callable, Collection, Optional, Type, Union
 
 import tomli
 
+import pyvrp.construct
+import pyvrp.crossover
 import pyvrp.search
 from pyvrp.GeneticAlgorithm import GeneticAlgorithm, GeneticAlgorithmParams
 from pyvrp.PenaltyManager import PenaltyManager, PenaltyParams
 from pyvrp.Population import Population, PopulationParams
-from pyvrp._pyvrp import ProblemData, RandomNumberGenerator, Solution
+from pyvrp._pyvrp import (
+    CostEvaluator,
+    ProblemData,
+    RandomNumberGenerator,
+    Route,
+    Solution,
+)
 from pyvrp.crossover import ordered_crossover as ox
 from pyvrp.crossover import selective_route_exchange as srex
 from pyvrp.diversity import broken_pairs_distance as bpd
+from pyvrp.repair import neighbour_repair
 from pyvrp.search import (
     NODE_OPERATORS,
     ROUTE_OPERATORS,
@@ -20,7 +33,9 @@ from pyvrp.search import (
     NodeOperator,
     RouteOperator,
     compute_neighbours,
+    extend_neighbours,
 )
+from pyvrp.search._search import LocalSearch as _LocalSearch
 
 if TYPE_CHECKING:
     import pathlib
@@ -28,6 +43,21 @@ if TYPE_CHECKING:
     from pyvrp.Result import Result
     from pyvrp.stop import StoppingCriterion
 
+    CrossoverOperator = Callable[
+        [
+            tuple[Solution, Solution],
+            ProblemData,
+            CostEvaluator,
+            RandomNumberGenerator,
+        ],
+        Solution,
+    ]
+
+    ConstructionOperator = Callable[
+        [ProblemData, CostEvaluator, RandomNumberGenerator, list[list[int]]],
+        Solution,
+    ]
+
 
 class SolveParams:
     """
@@ -47,6 +77,17 @@ class SolveParams:
         Node operators to use in the search.
     route_ops
         Route operators to use in the search.
+    crossover_op
+        Crossover operator to use. If not provided, the solver uses
+        :func:`~pyvrp.crossover.selective_route_exchange` for instances with
+        multiple vehicles, and :func:`~pyvrp.crossover.ordered_crossover`
+        otherwise.
+    construct_op
+        Construction heuristic used to generate the initial population, for
+        example one of the heuristics in :mod:`pyvrp.construct`. It is called
+        with the data instance, a cost evaluator, a random number generator,
+        and the solver's granular neighbourhood. If not provided, the initial
+        population consists of random solutions.
     """
 
     def __init__(
@@ -57,6 +98,8 @@ class SolveParams:
         neighbourhood: NeighbourhoodParams = NeighbourhoodParams(),
         node_ops: list[Type[NodeOperator]] = NODE_OPERATORS,
         route_ops: list[Type[RouteOperator]] = ROUTE_OPERATORS,
+        crossover_op: Optional[CrossoverOperator] = None,
+        construct_op: Optional[ConstructionOperator] = None,
     ):
         self._genetic = genetic
         self._penalty = penalty
@@ -64,6 +107,8 @@ class SolveParams:
         self._neighbourhood = neighbourhood
         self._node_ops = node_ops
         self._route_ops = route_ops
+        self._crossover_op = crossover_op
+        self._construct_op = construct_op
 
     def __eq__(self, other: object) -> bool:
         return (
@@ -74,6 +119,8 @@ class SolveParams:
             and self.neighbourhood == other.neighbourhood
             and self.node_ops == other.node_ops
             and self.route_ops == other.route_ops
+            and self.crossover_op == other.crossover_op
+            and self.construct_op == other.construct_op
         )
 
     @property
@@ -100,6 +147,14 @@ class SolveParams:
     def route_ops(self):
         return self._route_ops
 
+    @property
+    def crossover_op(self):
+        return self._crossover_op
+
+    @property
+    def construct_op(self):
+        return self._construct_op
+
     @classmethod
     def from_file(cls, loc: Union[str, pathlib.Path]):
         """
@@ -121,11 +176,47 @@ class SolveParams:
         if "route_ops" in data:
             route_ops = [getattr(pyvrp.search, op) for op in data["route_ops"]]
 
+        crossover_op = None
+        if "crossover_op" in data:
+            crossover_op = getattr(pyvrp.crossover, data["crossover_op"])
+
+        construct_op = None
+        if "construct_op" in data:
+            construct_op = getattr(pyvrp.construct, data["construct_op"])
+
         return cls(
-            gen_params, pen_params, pop_params, nb_params, node_ops, route_ops
+            gen_params,
+            pen_params,
+            pop_params,
+            nb_params,
+            node_ops,
+            route_ops,
+            crossover_op,
+            construct_op,
         )
 
 
+def _crossover_op(data: ProblemData, params: SolveParams):
+    if params.crossover_op is not None:
+        return params.crossover_op
+
+    # We use SREX when the instance is a proper VRP; else OX for TSP.
+    return srex if data.num_vehicles > 1 else ox
+
+
+def _make_initial(
+    data: ProblemData,
+    params: SolveParams,
+    cost_eval: CostEvaluator,
+    rng: RandomNumberGenerator,
+    neighbours: list[list[int]],
+) -> Solution:
+    if params.construct_op is not None:
+        return params.construct_op(data, cost_eval, rng, neighbours)
+
+    return Solution.make_random(data, rng)
+
+
 def solve(
     data: ProblemData,
     stop: StoppingCriterion,
@@ -174,13 +265,324 @@ def solve(
     pm = PenaltyManager.init_from(data, params.penalty)
     pop = Population(bpd, params.population)
     init = [
-        Solution.make_random(data, rng)
+        _make_initial(data, params, pm.cost_evaluator(), rng, neighbours)
         for _ in range(params.population.min_pop_size)
     ]
 
-    # We use SREX when the instance is a proper VRP; else OX for TSP.
-    crossover = srex if data.num_vehicles > 1 else ox
-
+    crossover = _crossover_op(data, params)
     gen_args = (data, pm, rng, pop, ls, crossover, init, params.genetic)
     algo = GeneticAlgorithm(*gen_args)  # type: ignore
     return algo.run(stop, collect_stats, display)
+
+
+class Solver:
+    """
+    Long-lived solver for repeatedly solving the same problem data instance.
+    The solver computes the neighbourhood structure and initial penalty values
+    once, and keeps a local search object (with its operators) per worker
+    warm between solves. Solve requests are served by a pool of worker
+    threads, so several requests can be solved concurrently.
+
+    .. note::
+
+       Each solve is seeded, but workers reuse their search state between
+       requests. Tie-breaking in the search may thus depend on earlier
+       requests, so results need not exactly match those of :func:`solve`.
+
+    Parameters
+    ----------
+    data
+        Problem data instance to solve.
+    params
+        Solver parameters to use. If not provided, a default will be used.
+    num_workers
+        Number of worker threads that serve solve requests. Default 1.
+
+    Raises
+    ------
+    ValueError
+        When ``num_workers`` is not positive.
+    """
+
+    def __init__(
+        self,
+        data: ProblemData,
+        params: SolveParams = SolveParams(),
+        num_workers: int = 1,
+    ):
+        if num_workers < 1:
+            raise ValueError("Expected num_workers > 0.")
+
+        self._data = data
+        self._params = params
+        self._num_workers = num_workers
+        self._pm = PenaltyManager.init_from(data, params.penalty)
+        self._neighbours = compute_neighbours(data, params.neighbourhood)
+
+        self._searches: SimpleQueue[_LocalSearch] = SimpleQueue()
+        for _ in range(num_workers):
+            self._searches.put(self._make_search())
+
+        self._executor = ThreadPoolExecutor(max_workers=num_workers)
+
+    def __enter__(self) -> Solver:
+        return self
+
+    def __exit__(self, *args):
+        self.shutdown()
+
+    def solve(
+        self,
+        stop: StoppingCriterion,
+        seed: int = 0,
+        initial_solutions: Collection[Solution] = (),
+        collect_stats: bool = True,
+        display: bool = False,
+        frozen_routes: Collection[Route] = (),
+    ) -> Result:
+        """
+        Solves the problem data instance, and waits for the result. See
+        :meth:`~submit` for a description of the arguments.
+
+        Returns
+        -------
+        Result
+            A Result object, containing statistics (if collected) and the best
+            found solution.
+        """
+        future = self.submit(
+            stop,
+            seed,
+            initial_solutions,
+            collect_stats,
+            display,
+            frozen_routes,
+        )
+
+        return future.result()
+
+    def submit(
+        self,
+        stop: StoppingCriterion,
+        seed: int = 0,
+        initial_solutions: Collection[Solution] = (),
+        collect_stats: bool = True,
+        display: bool = False,
+        frozen_routes: Collection[Route] = (),
+    ) -> Future[Result]:
+        """
+        Submits a solve request to the worker pool, and returns immediately.
+
+        Parameters
+        ----------
+        stop
+            Stopping criterion to use. Since requests may be solved
+            concurrently, each request should use its own stopping criterion.
+        seed
+            Seed value to use for the random number stream. Default 0.
+        initial_solutions
+            Solutions to warm-start the search with, for example a previous
+            plan. The population is further initialised with new solutions
+            until it reaches its minimum size. These are constructed using the
+            construction heuristic of the solver parameters, if any, and are
+            random otherwise.
+        collect_stats
+            Whether to collect statistics about the solver's progress. Default
+            ``True``.
+        display
+            Whether to display information about the solver progress. Default
+            ``False``.
+        frozen_routes
+            Routes, or route prefixes, that must be kept as they are, for
+            example because they have already been dispatched. The search
+            only changes the other parts of the solutions. See
+            :class:`~pyvrp.GeneticAlgorithm.GeneticAlgorithm` for details.
+
+        Returns
+        -------
+        Future[Result]
+            A future that resolves to the Result object of this request. The
+            future raises a ValueError when the solver moved to another
+            problem data instance through :meth:`~add_clients` before this
+            request started.
+        """
+        return self._executor.submit(
+            self._solve,
+            self._data,
+            stop,
+            seed,
+            list(initial_solutions),
+            collect_stats,
+            display,
+            list(frozen_routes),
+        )
+
+    def add_clients(
+        self,
+        data: ProblemData,
+        solutions: Collection[Solution] = (),
+    ) -> list[Solution]:
+        """
+        Moves the solver to a new problem data instance that extends the
+        current instance with new clients, for example when new orders arrive
+        while the current plan is being executed. This does not change
+        requests that are being solved: the new clients are only considered
+        by requests that are submitted afterwards. The neighbourhood structure
+        is extended incrementally, and the given solutions are transferred to
+        the new instance with the new clients inserted into them using
+        :func:`~pyvrp.repair.neighbour_repair`, which only evaluates inserting
+        new clients next to their neighbours, or into a new route of an unused
+        vehicle. These solutions can then be used to warm-start the next solve
+        request on the new instance.
+
+        .. note::
+
+           The new clients must be appended after the existing clients, and
+           the data of the existing depots, clients, and vehicle types must
+           not change. This method waits until all running requests have been
+           solved. Requests that were submitted earlier, but had not yet
+           started, are not solved: their futures raise a ValueError, since
+           their initial solutions and frozen routes belong to the previous
+           instance.
+
+        Parameters
+        ----------
+        data
+            New problem data instance, containing the new clients.
+        solutions
+            Solutions of the current instance to transfer to the new instance,
+            for example the best solution of the last solve request.
+
+        Returns
+        -------
+        list[Solution]
+            The given solutions, transferred to the new instance, with the new
+            clients inserted.
+
+        Raises
+        ------
+        ValueError
+            When the new instance has different depots, or fewer clients than
+            the current instance.
+        """
+        old = self._data
+        if data.num_depots != old.num_depots:
+            raise ValueError("Expected the same depots.")
+
+        if data.num_clients < old.num_clients:
+            raise ValueError("Expected new clients to be appended.")
+
+        # Take all search objects out of the queue, which waits for all
+        # running requests to finish, and replace them with search objects
+        # for the new instance.
+        for _ in range(self._num_workers):
+            self._searches.get()
+
+        params = self._params
+        self._neighbours = extend_neighbours(
+            data, self._neighbours, params.neighbourhood
+        )
+        self._data = data
+
+        for _ in range(self._num_workers):
+            self._searches.put(self._make_search())
+
+        # The initial penalty values are not recomputed, since that takes
+        # quadratic time, and the values need only be roughly right anyway.
+        cost_eval = self._pm.cost_evaluator()
+        new_clients = list(range(old.num_locations, data.num_locations))
+
+        transferred = []
+        for sol in solutions:
+            routes = [
+                Route(data, route.visits(), route.vehicle_type())
+                for route in sol.routes()
+            ]
+
+            # Add an empty route for each unused vehicle, so that the repair
+            # can also open a new route for a new client.
+            used = Counter(route.vehicle_type() for route in routes)
+            for vehicle_type, veh_type in enumerate(data.vehicle_types()):
+                num_unused = veh_type.num_available - used[vehicle_type]
+                routes += [Route(data, [], vehicle_type)] * num_unused
+
+            routes = neighbour_repair(
+                routes, new_clients, data, cost_eval, self._neighbours
+            )
+            routes = [route for route in routes if len(route) > 0]
+            transferred.append(Solution(data, routes))
+
+        return transferred
+
+    def shutdown(self, wait: bool = True):
+        """
+        Shuts down the worker pool. Requests that were already submitted are
+        still solved, but new requests cannot be submitted.
+
+        Parameters
+        ----------
+        wait
+            Whether to wait until all submitted requests have been solved.
+            Default ``True``.
+        """
+        self._executor.shutdown(wait=wait)
+
+    def _make_search(self) -> _LocalSearch:
+        data = self._data
+        ls = _LocalSearch(data, self._neighbours)
+
+        for node_op in self._params.node_ops:
+            ls.add_node_operator(node_op(data))
+
+        for route_op in self._params.route_ops:
+            ls.add_route_operator(route_op(data))
+
+        return ls
+
+    def _solve(
+        self,
+        submitted_data: ProblemData,
+        stop: StoppingCriterion,
+        seed: int,
+        initial_solutions: list[Solution],
+        collect_stats: bool,
+        display: bool,
+        frozen_routes: list[Route],
+    ) -> Result:
+        # There are exactly as many search objects as workers, so there is
+        # always one available for the current worker. The data instance
+        # only changes while no search objects are available.
+        ls = self._searches.get()
+        data = self._data
+        params = self._params
+        rng = RandomNumberGenerator(seed=seed)
+
+        def search(solution: Solution, cost_eval: CostEvaluator) -> Solution:
+            ls.shuffle(rng)
+            return ls(solution, cost_eval)
+
+        try:
+            if data is not submitted_data:
+                msg = "Problem data changed since this request was submitted."
+                raise ValueError(msg)
+
+            ls.set_frozen_clients([c for r in frozen_routes for c in r])
+
+            pm = deepcopy(self._pm)  # fresh copy with the initial penalties
+            pop = Population(bpd, params.population)
+            min_size = params.population.min_pop_size
+            init = initial_solutions + [
+                _make_initial(
+                    data, params, pm.cost_evaluator(), rng, self._neighbours
+                )
+                for _ in range(min_size - len(initial_solutions))
+            ]
+
+            crossover = _crossover_op(data, params)
+            gen_args = (data, pm, rng, pop, search, crossover, init)
+            gen_params = (params.genetic, frozen_routes)
+            algo = GeneticAlgorithm(*gen_args, *gen_params)  # type: ignore
+            return algo.run(stop, collect_stats, display)
+        finally:
+            ls.set_frozen_clients([])
+            self._searches.put(ls)
@@ -0,0 +1,65 @@
+import pytest
+from numpy.testing import assert_, assert_equal
+
+from pyvrp import CostEvaluator, RandomNumberGenerator, Solution, VehicleType
+from pyvrp.construct import regret_insertion, savings, sweep
+from pyvrp.search import compute_neighbours
+
+HEURISTICS = [savings, sweep, regret_insertion]
+
+
+@pytest.mark.parametrize("construct", HEURISTICS)
+def test_visits_all_required_clients(rc208, construct):
+    """
+    Tests that the constructed solution visits all clients on a larger instance
+    with time windows where all clients are required.
+    """
+    cost_eval = CostEvaluator(20, 6, 0)
+    rng = RandomNumberGenerator(seed=42)
+
+    sol = construct(rc208, cost_eval, rng, compute_neighbours(rc208))
+    assert_equal(sol.num_clients(), rc208.num_clients)
+    assert_(sol.num_routes() <= rc208.num_vehicles)
+
+
+@pytest.mark.parametrize("construct", HEURISTICS)
+def test_respects_available_vehicles(ok_small, construct):
+    """
+    Tests that the constructed solution never uses more vehicles of a type than
+    there are available.
+    """
+    cost_eval = CostEvaluator(20, 6, 0)
+    rng = RandomNumberGenerator(seed=42)
+
+    data = ok_small.replace(vehicle_types=[VehicleType(1, capacity=10)])
+    sol = construct(data, cost_eval, rng, compute_neighbours(data))
+    assert_equal(sol.num_routes(), 1)
+    assert_equal(sol.num_clients(), data.num_clients)
+
+    vehicle_types = [VehicleType(1, capacity=10), VehicleType(1, capacity=5)]
+    data = ok_small.replace(vehicle_types=vehicle_types)
+    sol = construct(data, cost_eval, rng, compute_neighbours(data))
+
+    types = [route.vehicle_type() for route in sol.routes()]
+    assert_equal(len(set(types)), len(types))
+    assert_equal(sol.num_clients(), data.num_clients)
+
+
+@pytest.mark.parametrize("construct", HEURISTICS)
+def test_better_than_random(small_cvrp, construct):
+    """
+    Tests that the construction heuristic constructs better solutions than
+    random solutions, on average.
+    """
+    cost_eval = CostEvaluator(20, 6, 0)
+    rng = RandomNumberGenerator(seed=42)
+
+    neighbours = compute_neighbours(small_cvrp)
+    constructed = [
+        construct(small_cvrp, cost_eval, rng, neighbours) for _ in range(10)
+    ]
+    random = [Solution.make_random(small_cvrp, rng) for _ in range(10)]
+
+    constructed_cost = sum(map(cost_eval.penalised_cost, constructed))
+    random_cost = sum(map(cost_eval.penalised_cost, random))
+    assert_(constructed_cost < random_cost)
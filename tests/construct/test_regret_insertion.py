@@ -0,0 +1,28 @@
+from numpy.testing import assert_equal, assert_raises
+
+from pyvrp import CostEvaluator, RandomNumberGenerator
+from pyvrp.construct import regret_insertion
+
+
+def test_raises_zero_num_regret(ok_small):
+    """
+    Tests that regret insertion raises when the regret value would be computed
+    over no routes at all.
+    """
+    cost_eval = CostEvaluator(20, 6, 0)
+    rng = RandomNumberGenerator(seed=42)
+
+    with assert_raises(ValueError):
+        regret_insertion(ok_small, cost_eval, rng, num_regret=0)
+
+
+def test_one_regret_is_cheapest_insertion(ok_small):
+    """
+    Tests that regret insertion also works when each client's regret is
+    computed over just its best route. That is a cheapest insertion heuristic.
+    """
+    cost_eval = CostEvaluator(20, 6, 0)
+    rng = RandomNumberGenerator(seed=42)
+
+    sol = regret_insertion(ok_small, cost_eval, rng, num_regret=1)
+    assert_equal(sol.num_clients(), ok_small.num_clients)
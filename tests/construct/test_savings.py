@@ -0,0 +1,34 @@
+from numpy.testing import assert_equal, assert_raises
+
+from pyvrp import CostEvaluator, RandomNumberGenerator
+from pyvrp.construct import savings
+
+
+def test_no_neighbours(ok_small):
+    """
+    Tests that no routes are merged when no neighbours are considered. The
+    giant tour is then still split into routes, so every client is visited.
+    """
+    cost_eval = CostEvaluator(20, 6, 0)
+    rng = RandomNumberGenerator(seed=42)
+
+    neighbours = [[] for _ in range(ok_small.num_locations)]
+    sol = savings(ok_small, cost_eval, rng, neighbours)
+    assert_equal(sol.num_clients(), ok_small.num_clients)
+
+
+def test_raises_invalid_neighbourhood(ok_small):
+    """
+    Tests that savings raises when the neighbourhood does not match the data
+    instance.
+    """
+    cost_eval = CostEvaluator(20, 6, 0)
+    rng = RandomNumberGenerator(seed=42)
+
+    with assert_raises(ValueError):  # too few locations
+        savings(ok_small, cost_eval, rng, [[]])
+
+    with assert_raises(ValueError):  # neighbour is not a valid location
+        neighbours = [[] for _ in range(ok_small.num_locations)]
+        neighbours[1] = [ok_small.num_locations]
+        savings(ok_small, cost_eval, rng, neighbours)
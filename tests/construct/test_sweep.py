@@ -0,0 +1,16 @@
+from numpy.testing import assert_
+
+from pyvrp import CostEvaluator, RandomNumberGenerator
+from pyvrp.construct import sweep
+
+
+def test_different_seeds_diversify(small_cvrp):
+    """
+    Tests that the random start angle and direction result in different
+    solutions for different random number generator states.
+    """
+    cost_eval = CostEvaluator(20, 6, 0)
+    rng = RandomNumberGenerator(seed=42)
+
+    sols = [sweep(small_cvrp, cost_eval, rng) for _ in range(10)]
+    assert_(any(sol != sols[0] for sol in sols[1:]))
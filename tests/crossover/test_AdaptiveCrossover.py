@@ -0,0 +1,51 @@
+from numpy.testing import assert_equal, assert_raises
+
+from pyvrp import CostEvaluator, RandomNumberGenerator, Solution
+from pyvrp.crossover import AdaptiveCrossover
+
+
+def test_raises_invalid_arguments():
+    """
+    Tests that the adaptive crossover operator raises when it has no operators
+    to select from, or when the maximum number of moved routes is not positive.
+    """
+    with assert_raises(ValueError):
+        AdaptiveCrossover([])
+
+    with assert_raises(ValueError):
+        AdaptiveCrossover.srex_variants(max_moved_routes=0)
+
+
+def test_update_raises_before_first_call():
+    """
+    Tests that updating raises when no operator has been applied yet.
+    """
+    crossover = AdaptiveCrossover.srex_variants()
+
+    with assert_raises(ValueError):
+        crossover.update(1.0, 1.0)
+
+
+def test_srex_variants(ok_small):
+    """
+    Tests that the SREX variants include each combination of number of moved
+    routes and start index strategy, and that updates are attributed to the
+    most recently applied variant.
+    """
+    crossover = AdaptiveCrossover.srex_variants(max_moved_routes=2)
+    assert_equal(crossover.selector.num_operators(), 4)
+
+    rng = RandomNumberGenerator(seed=42)
+    cost_eval = CostEvaluator(20, 6, 0)
+    sol1 = Solution(ok_small, [[1, 2], [3, 4]])
+    sol2 = Solution(ok_small, [[1, 3], [2, 4]])
+
+    for op in range(4):
+        crossover((sol1, sol2), ok_small, cost_eval, rng)
+        crossover.update(op + 1, 1.0)
+
+    # Each variant has been applied once, in order, since the selector first
+    # tries each operator that has not yet been updated.
+    assert_equal(crossover.selector.num_updates(), [1, 1, 1, 1])
+    assert_equal(crossover.selector.improvements(), [1, 2, 3, 4])
+    assert_equal(crossover.selector.select(), 3)
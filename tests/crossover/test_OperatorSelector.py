@@ -0,0 +1,88 @@
+from numpy.testing import assert_allclose, assert_equal, assert_raises
+from pytest import mark
+
+from pyvrp.crossover import OperatorSelector
+
+
+@mark.parametrize(
+    ("num_operators", "exploration"),
+    [
+        (0, 1.0),  # no operators
+        (1, -1.0),  # negative exploration
+    ],
+)
+def test_raises_invalid_arguments(num_operators: int, exploration: float):
+    """
+    Tests that the constructor raises when given invalid arguments.
+    """
+    with assert_raises(ValueError):
+        OperatorSelector(num_operators, exploration)
+
+
+def test_update_raises_invalid_arguments():
+    """
+    Tests that updating an operator that does not exist, or with a negative
+    duration, raises.
+    """
+    selector = OperatorSelector(2)
+
+    with assert_raises(IndexError):
+        selector.update(2, 1.0, 1.0)
+
+    with assert_raises(ValueError):
+        selector.update(0, 1.0, -1.0)
+
+
+def test_selects_operators_that_have_not_been_updated_first():
+    """
+    Tests that each operator is selected once before the bandit policy starts
+    comparing the operators' statistics.
+    """
+    selector = OperatorSelector(3)
+
+    for op in range(3):
+        assert_equal(selector.select(), op)
+        selector.update(op, 0.0, 1.0)
+
+
+def test_greedy_selection_picks_best_rate():
+    """
+    Tests that the selector picks the operator with the highest improvement
+    per unit of time when exploration is disabled.
+    """
+    selector = OperatorSelector(3, exploration=0)
+    selector.update(0, 10.0, 1.0)  # rate 10
+    selector.update(1, 10.0, 0.5)  # rate 20
+    selector.update(2, 30.0, 2.0)  # rate 15
+    assert_equal(selector.select(), 1)
+
+
+def test_exploration_favours_rarely_updated_operators():
+    """
+    Tests that, with sufficient exploration, an operator with a lower rate is
+    selected when it has been tried much less often than the others.
+    """
+    selector = OperatorSelector(2, exploration=1)
+    selector.update(1, 1.0, 1.0)
+
+    for _ in range(100):
+        selector.update(0, 2.0, 1.0)
+
+    assert_equal(selector.select(), 1)
+
+
+def test_statistics():
+    """
+    Tests that the selector tracks the number of updates, total improvement,
+    and total duration of each operator. Negative improvements are counted as
+    no improvement.
+    """
+    selector = OperatorSelector(2)
+    selector.update(0, 5.0, 1.0)
+    selector.update(0, -3.0, 2.0)
+    selector.update(1, 1.5, 0.5)
+
+    assert_equal(selector.num_operators(), 2)
+    assert_equal(selector.num_updates(), [2, 1])
+    assert_allclose(selector.improvements(), [5.0, 1.5])
+    assert_allclose(selector.durations(), [3.0, 0.5])
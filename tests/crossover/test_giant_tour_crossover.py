@@ -0,0 +1,87 @@
+from numpy.testing import assert_, assert_equal
+
+from pyvrp import CostEvaluator, RandomNumberGenerator, Solution, VehicleType
+from pyvrp.crossover import giant_tour_crossover as gtx
+from pyvrp.crossover._crossover import giant_tour_crossover as cpp_gtx
+
+
+def test_same_parents_no_worse_offspring(ok_small):
+    """
+    Tests that the offspring of two identical parents is no worse than the
+    parents, when the offspring's giant tour equals that of the parents. The
+    parent is one of the ways to split that giant tour, and split finds the
+    best one.
+    """
+    cost_eval = CostEvaluator(20, 6, 0)
+    sol = Solution(ok_small, [[1, 2], [3, 4]])
+
+    # Nothing is copied from the first parent, so the offspring's giant tour
+    # is taken entirely from the second parent.
+    offspring = cpp_gtx((sol, sol), ok_small, cost_eval, (0, 0))
+    assert_equal(offspring.num_clients(), ok_small.num_clients)
+
+    offspring_cost = cost_eval.penalised_cost(offspring)
+    assert_(offspring_cost <= cost_eval.penalised_cost(sol))
+
+
+def test_respects_available_vehicles(ok_small):
+    """
+    Tests that the offspring never uses more vehicles of a type than there are
+    available, even when using more vehicles would be cheaper.
+    """
+    cost_eval = CostEvaluator(20, 6, 0)
+    sol1 = Solution(ok_small, [[1, 2], [3, 4]])
+    sol2 = Solution(ok_small, [[1, 3], [2, 4]])
+
+    # With a single vehicle, all clients must be served by one route, even
+    # though that route exceeds the vehicle's capacity.
+    data = ok_small.replace(vehicle_types=[VehicleType(1, capacity=10)])
+    offspring = cpp_gtx((sol1, sol2), data, cost_eval, (0, 2))
+    assert_equal(offspring.num_routes(), 1)
+    assert_equal(offspring.num_clients(), data.num_clients)
+    assert_(not offspring.is_feasible())
+
+    # With two vehicle types, each with a single vehicle available, each
+    # vehicle type should be used at most once.
+    vehicle_types = [VehicleType(1, capacity=10), VehicleType(1, capacity=5)]
+    data = ok_small.replace(vehicle_types=vehicle_types)
+    offspring = cpp_gtx((sol1, sol2), data, cost_eval, (0, 2))
+
+    types = [route.vehicle_type() for route in offspring.routes()]
+    assert_equal(len(set(types)), len(types))
+    assert_equal(offspring.num_clients(), data.num_clients)
+
+
+def test_offspring_is_complete(rc208):
+    """
+    Tests that the offspring visits all clients that are visited by either
+    parent, on a larger instance with many vehicles.
+    """
+    cost_eval = CostEvaluator(20, 6, 0)
+    rng = RandomNumberGenerator(seed=42)
+
+    for _ in range(10):
+        sol1 = Solution.make_random(rc208, rng)
+        sol2 = Solution.make_random(rc208, rng)
+
+        offspring = gtx((sol1, sol2), rc208, cost_eval, rng)
+        assert_equal(offspring.num_clients(), rc208.num_clients)
+        assert_(offspring.num_routes() <= rc208.num_vehicles)
+
+
+def test_empty_solution(prize_collecting):
+    """
+    Tests that the operator returns the other parent when one of the solutions
+    is empty, since then there is nothing to exchange.
+    """
+    cost_eval = CostEvaluator(20, 6, 0)
+    rng = RandomNumberGenerator(seed=42)
+
+    empty = Solution(prize_collecting, [])
+    nonempty = Solution(prize_collecting, [[1, 2, 3, 4]])
+
+    assert_equal(gtx((empty, empty), prize_collecting, cost_eval, rng), empty)
+
+    for parents in [(empty, nonempty), (nonempty, empty)]:
+        offspring = gtx(parents, prize_collecting, cost_eval, rng)
+        assert_equal(offspring, nonempty)
@@ -16,6 +16,7 @@ from pyvrp import (
     Solution,
     VehicleType,
 )
+from pyvrp.crossover import select_routes
 from pyvrp.crossover import selective_route_exchange as srex
 from pyvrp.crossover._crossover import selective_route_exchange as cpp_srex
 from pyvrp.exceptions import TspWarning
@@ -101,6 +102,30 @@ def test_srex_move_all_routes(ok_small):
     assert_equal(offspring, sol2)
 
 
+@mark.parametrize("aligned_start", [True, False])
+def test_srex_caps_fixed_number_of_moved_routes(ok_small, aligned_start):
+    """
+    Tests that a fixed number of moved routes is capped at the number of
+    routes in either parent. Moving all routes results in an offspring that is
+    identical to the second parent, regardless of the start indices.
+    """
+    cost_evaluator = CostEvaluator(20, 6, 0)
+    rng = RandomNumberGenerator(seed=42)
+
+    sol1 = Solution(ok_small, [[1], [2], [3, 4]])
+    sol2 = Solution(ok_small, [[1, 2], [3], [4]])
+    offspring = srex(
+        (sol1, sol2),
+        ok_small,
+        cost_evaluator,
+        rng,
+        num_moved_routes=10,
+        aligned_start=aligned_start,
+    )
+
+    assert_equal(offspring, sol2)
+
+
 def test_srex_sorts_routes(ok_small):
     """
     Tests if SREX sorts the input before applying the operator.
@@ -352,3 +377,35 @@ def test_srex_tsp_instance_returns_a_parent_solution(pr107):
         for _ in range(10):  # a few times to be sure
             offspring = srex((sol1, sol2), pr107, cost_eval, rng)
             assert_(offspring in (sol1, sol2))
+
+
+def test_select_routes(rc208):
+    """
+    Tests that select_routes() returns valid start indices, and respects the
+    number of moved routes and the aligned start argument.
+    """
+    rng = RandomNumberGenerator(seed=42)
+    parents = (
+        Solution.make_random(rc208, rng),
+        Solution.make_random(rc208, rng),
+    )
+    first, second = parents
+    max_routes = min(first.num_routes(), second.num_routes())
+
+    for _ in range(10):
+        (idx1, idx2), num_routes = select_routes(parents, rng)
+        assert_(0 <= idx1 < first.num_routes())
+        assert_(0 <= idx2 < second.num_routes())
+        assert_(
+            1 <= num_routes <= min(first.num_routes(), second.num_routes())
+        )
+
+        if idx1 < second.num_routes():  # aligned start by default
+            assert_equal(idx2, idx1)
+
+    # The number of moved routes is capped at the number of parent routes.
+    _, num_routes = select_routes(parents, rng, num_moved_routes=1)
+    assert_equal(num_routes, 1)
+
+    _, num_routes = select_routes(parents, rng, num_moved_routes=1_000)
+    assert_equal(num_routes, max_routes)
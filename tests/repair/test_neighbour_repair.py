@@ -0,0 +1,112 @@
+import pytest
+from numpy.testing import assert_, assert_equal, assert_raises
+
+from pyvrp import CostEvaluator, RandomNumberGenerator, Route, Solution
+from pyvrp.repair import greedy_repair, neighbour_repair
+from pyvrp.search import compute_neighbours
+
+
+def test_raises_given_no_routes_and_unplanned_clients(ok_small):
+    """
+    Tests that neighbour repair raises when it's not given any routes to insert
+    unplanned clients into, since it does not create new routes.
+    """
+    cost_eval = CostEvaluator(1, 1, 0)
+    neighbours = compute_neighbours(ok_small)
+
+    # This call should not raise since unplanned is empty.
+    neighbour_repair([], [], ok_small, cost_eval, neighbours)
+
+    with assert_raises(ValueError):
+        neighbour_repair([], [1], ok_small, cost_eval, neighbours)
+
+
+def test_raises_invalid_neighbourhood(ok_small):
+    """
+    Tests that neighbour repair raises when the neighbourhood does not match
+    the data instance.
+    """
+    cost_eval = CostEvaluator(1, 1, 0)
+    routes = [Route(ok_small, [2, 3], 0)]
+
+    with assert_raises(ValueError):  # too few neighbour lists
+        neighbour_repair(routes, [1], ok_small, cost_eval, [[], []])
+
+    with assert_raises(ValueError):  # neighbour is not a location
+        neighbours = [[], [ok_small.num_locations], [], [], []]
+        neighbour_repair(routes, [1], ok_small, cost_eval, neighbours)
+
+
+def test_inserts_next_to_neighbours(ok_small):
+    """
+    Tests that neighbour repair only evaluates inserting next to a client's
+    neighbours. Client 4 is cheapest to insert directly after the depot in the
+    route below, but that is not next to its only neighbour, client 1.
+    """
+    cost_eval = CostEvaluator(1, 1, 0)
+    route = Route(ok_small, [3, 2, 1], 0)
+
+    repaired = greedy_repair([route], [4], ok_small, cost_eval)
+    assert_equal(repaired[0].visits(), [4, 3, 2, 1])
+
+    neighbours = [[], [], [], [], [1]]
+    repaired = neighbour_repair([route], [4], ok_small, cost_eval, neighbours)
+    assert_(repaired[0].visits() in ([3, 2, 4, 1], [3, 2, 1, 4]))
+
+
+def test_no_planned_neighbours_is_greedy(ok_small):
+    """
+    Tests that neighbour repair evaluates all moves, like greedy repair, when
+    none of a client's neighbours are in the routes and there are no empty
+    routes.
+    """
+    cost_eval = CostEvaluator(1, 1, 0)
+    routes = Solution(ok_small, [[2], [3]]).routes()
+    neighbours = [[] for _ in range(ok_small.num_locations)]
+
+    unplanned = [1, 4]
+
+    greedy = greedy_repair(routes, unplanned, ok_small, cost_eval)
+    repaired = neighbour_repair(
+        routes, unplanned, ok_small, cost_eval, neighbours
+    )
+    assert_equal(repaired, greedy)
+
+
+def test_inserts_into_empty_route(ok_small):
+    """
+    Tests that neighbour repair also evaluates inserting into empty routes,
+    even though empty routes do not contain any neighbours.
+    """
+    cost_eval = CostEvaluator(1, 1, 0)
+    neighbours = compute_neighbours(ok_small)
+
+    routes = [Route(ok_small, [], 0)]
+    repaired = neighbour_repair(routes, [1], ok_small, cost_eval, neighbours)
+    assert_equal(repaired, [Route(ok_small, [1], 0)])
+
+
+@pytest.mark.parametrize("seed", [0, 13, 42])
+def test_RC208(rc208, seed: int):
+    """
+    This smoke test checks that neighbour repair is better than random on a
+    larger instance, for several seeds.
+    """
+    rng = RandomNumberGenerator(seed=seed)
+    random = Solution.make_random(rc208, rng)
+
+    # Dummy routes that use all vehicles, into which we insert the remaining
+    # clients.
+    routes = [[idx + 1] for idx in range(rc208.num_vehicles)]
+    to_repair = Solution(rc208, routes).routes()
+
+    cost_eval = CostEvaluator(1, 1, 0)
+    neighbours = compute_neighbours(rc208)
+    unplanned = list(range(rc208.num_vehicles + 1, rc208.num_locations))
+    repaired = neighbour_repair(
+        to_repair, unplanned, rc208, cost_eval, neighbours
+    )
+
+    random_cost = cost_eval.penalised_cost(random)
+    repaired_cost = cost_eval.penalised_cost(Solution(rc208, repaired))
+    assert_(repaired_cost < random_cost)
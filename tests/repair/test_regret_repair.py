@@ -0,0 +1,197 @@
+import pytest
+from numpy.testing import assert_, assert_equal, assert_raises
+
+from pyvrp import CostEvaluator, RandomNumberGenerator, Route, Solution
+from pyvrp.repair import greedy_repair, regret_repair
+
+
+def test_raises_given_no_routes_and_unplanned_clients(ok_small):
+    """
+    Tests that regret repair raises when it's not given any routes to insert
+    unplanned clients into, since it does not create new routes.
+    """
+    cost_eval = CostEvaluator(1, 1, 0)
+
+    # This call should not raise since unplanned is empty.
+    regret_repair([], [], ok_small, cost_eval)
+
+    with assert_raises(ValueError):
+        regret_repair([], [1], ok_small, cost_eval)
+
+
+def test_raises_zero_num_regret(ok_small):
+    """
+    Tests that regret repair raises when the regret value would be computed
+    over no routes at all.
+    """
+    cost_eval = CostEvaluator(1, 1, 0)
+    routes = [Route(ok_small, [], 0)]
+
+    with assert_raises(ValueError):
+        regret_repair(routes, [1], ok_small, cost_eval, num_regret=0)
+
+
+def test_empty_unplanned_is_a_no_op(ok_small):
+    """
+    When there are no unplanned clients, the returned routes should be the
+    same as those given as an argument.
+    """
+    cost_eval = CostEvaluator(1, 1, 0)
+
+    sol = Solution(ok_small, [[2, 3, 4]])
+    repaired = regret_repair(sol.routes(), [], ok_small, cost_eval)
+    assert_equal(repaired, sol.routes())
+
+
+def test_after_depot(ok_small):
+    """
+    Tests moves where it is optimal to insert directly after the depot.
+    """
+    cost_eval = CostEvaluator(1, 1, 0)
+
+    # It is optimal to insert client 4 directly after the depot, just before
+    # client 3.
+    route = Route(ok_small, [3, 2, 1], 0)
+    repaired = regret_repair([route], [4], ok_small, cost_eval)
+
+    assert_equal(len(repaired), 1)
+    assert_equal(repaired[0].visits(), [4, 3, 2, 1])
+
+
+def test_regret_order_differs_from_greedy_order(ok_small):
+    """
+    Tests that regret repair does not insert the clients in the given order,
+    like greedy repair does, but in order of decreasing regret value.
+    """
+    cost_eval = CostEvaluator(1, 1, 0)
+    routes = Solution(ok_small, [[2], [4]]).routes()
+
+    # Greedy repair first inserts client 1 into its best route, the one with
+    # client 2. Client 3 has a larger regret value, however, so regret repair
+    # inserts client 3 into that route first, and then client 1 elsewhere.
+    # That results in a cheaper solution.
+    greedy = greedy_repair(routes, [1, 3], ok_small, cost_eval)
+    assert_equal([route.visits() for route in greedy], [[1, 2], [3, 4]])
+
+    regret = regret_repair(routes, [1, 3], ok_small, cost_eval)
+    assert_equal([route.visits() for route in regret], [[3, 2], [1, 4]])
+
+    greedy_cost = cost_eval.penalised_cost(Solution(ok_small, greedy))
+    regret_cost = cost_eval.penalised_cost(Solution(ok_small, regret))
+    assert_(regret_cost < greedy_cost)
+
+
+@pytest.mark.parametrize("num_regret", [1, 2, 3])
+def test_inserts_all_unplanned_clients(ok_small, num_regret: int):
+    """
+    Tests that regret repair inserts all unplanned clients into the given
+    routes, without creating new routes, for several numbers of regret routes.
+    """
+    cost_eval = CostEvaluator(1, 1, 0)
+    routes = Solution(ok_small, [[2], [3]]).routes()
+
+    repaired = regret_repair(routes, [1, 4], ok_small, cost_eval, num_regret)
+    assert_equal(len(repaired), 2)
+
+    sol = Solution(ok_small, repaired)
+    assert_(sol.is_complete())
+
+
+@pytest.mark.parametrize("seed", [0, 13, 42])
+def test_RC208(rc208, seed: int):
+    """
+    This smoke test checks that regret repair is better than random on a larger
+    instance, for several seeds.
+    """
+    rng = RandomNumberGenerator(seed=seed)
+    random = Solution.make_random(rc208, rng)
+
+    # Dummy routes that use all vehicles, into which we insert the remaining
+    # clients.
+    routes = [[idx + 1] for idx in range(rc208.num_vehicles)]
+    to_repair = Solution(rc208, routes).routes()
+
+    cost_eval = CostEvaluator(1, 1, 0)
+    unplanned = list(range(rc208.num_vehicles + 1, rc208.num_locations))
+    regret = regret_repair(to_repair, unplanned, rc208, cost_eval)
+
+    random_cost = cost_eval.penalised_cost(random)
+    regret_cost = cost_eval.penalised_cost(Solution(rc208, regret))
+    assert_(regret_cost < random_cost)
+
+
+def _regret_repair_from_scratch(routes, unplanned, data, cost_eval, k):
+    """
+    Reference implementation of regret repair with ``k`` regret routes, which
+    recomputes all insertion costs from scratch after each insertion. Ties are
+    broken in the same way as regret repair does: routes by index, and clients
+    by insertion cost, and then by index.
+    """
+    routes = [(route.visits(), route.vehicle_type()) for route in routes]
+
+    def route_cost(visits, vehicle_type):
+        route = Route(data, visits, vehicle_type)
+        return cost_eval.penalised_cost(Solution(data, [route]))
+
+    unplanned = sorted(unplanned)
+    while unplanned:
+        best_key = best_insert = None
+
+        for client in unplanned:
+            inserts = []  # best insertion into each route
+            for idx, (visits, vehicle_type) in enumerate(routes):
+                curr_cost = route_cost(visits, vehicle_type)
+                best = None
+                for pos in range(len(visits) + 1):
+                    new = [*visits[:pos], client, *visits[pos:]]
+                    delta = route_cost(new, vehicle_type) - curr_cost
+                    if best is None or delta < best[0]:
+                        best = (delta, idx, pos)
+
+                inserts.append(best)
+
+            top = sorted(inserts)[:k]
+            regret = sum(cost - top[0][0] for cost, *_ in top)
+            key = (-regret, top[0][0], client)
+            if best_key is None or key < best_key:
+                best_key = key
+                best_insert = (client, *top[0][1:])
+
+        client, idx, pos = best_insert
+        visits, vehicle_type = routes[idx]
+        routes[idx] = ([*visits[:pos], client, *visits[pos:]], vehicle_type)
+        unplanned.remove(client)
+
+    return [Route(data, visits, typ) for visits, typ in routes]
+
+
+@pytest.mark.parametrize("num_regret", [1, 2, 3])
+def test_same_as_from_scratch_reference(rc208, num_regret: int):
+    """
+    Tests that regret repair, which only recomputes the insertion costs into
+    the route that was modified, inserts the same clients in the same places
+    as a reference implementation that recomputes everything from scratch.
+    """
+    rng = RandomNumberGenerator(seed=42)
+    cost_eval = CostEvaluator(20, 6, 0)
+
+    # Partial routes of a random solution, with a few clients left out. The
+    # instance is fairly large, so we only use some of its routes to keep the
+    # reference implementation fast.
+    sol = Solution.make_random(rc208, rng)
+    routes = []
+    unplanned = []
+    for route in sol.routes()[:8]:
+        visits = route.visits()
+        routes.append(Route(rc208, visits[::2], route.vehicle_type()))
+        unplanned.extend(visits[1::2][:3])
+
+    repaired = regret_repair(routes, unplanned, rc208, cost_eval, num_regret)
+    expected = _regret_repair_from_scratch(
+        routes, unplanned, rc208, cost_eval, num_regret
+    )
+
+    assert_equal(
+        [route.visits() for route in repaired],
+        [route.visits() for route in expected],
+    )
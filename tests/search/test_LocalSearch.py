@@ -1,3 +1,5 @@
+from concurrent.futures import ThreadPoolExecutor
+
 import numpy as np
 from numpy.testing import assert_, assert_equal, assert_raises
 from pytest import mark
@@ -12,6 +14,7 @@ from pyvrp import (
     Solution,
     VehicleType,
 )
+from pyvrp.crossover import selective_route_exchange as srex
 from pyvrp.search import (
     Exchange10,
     Exchange11,
@@ -515,3 +518,190 @@ def test_swap_if_improving_mutually_exclusive_group(
     routes = improved.routes()
     assert_equal(improved.num_routes(), 1)
     assert_equal(routes[0].visits(), [3, 4])
+
+
+def test_exported_routes_match_routes_computed_from_scratch(rc208):
+    """
+    Tests that the routes returned by the local search, which are built from
+    the search's cached route statistics, are exactly the same as routes
+    constructed from scratch using the same visits.
+    """
+    rng = RandomNumberGenerator(seed=42)
+
+    ls = LocalSearch(rc208, rng, compute_neighbours(rc208))
+    ls.add_node_operator(Exchange10(rc208))
+    ls.add_route_operator(SwapStar(rc208))
+
+    sol = Solution.make_random(rc208, rng)
+    improved = ls(sol, CostEvaluator(1, 1, 0))
+
+    for route in improved.routes():
+        expected = Route(rc208, route.visits(), route.vehicle_type())
+        assert_(route == expected)
+        assert_equal(route.duration(), expected.duration())
+        assert_equal(route.time_warp(), expected.time_warp())
+        assert_equal(route.travel_duration(), expected.travel_duration())
+        assert_equal(route.service_duration(), expected.service_duration())
+        assert_equal(route.wait_duration(), expected.wait_duration())
+        assert_equal(route.start_time(), expected.start_time())
+        assert_equal(route.slack(), expected.slack())
+        assert_equal(route.release_time(), expected.release_time())
+        assert_equal(route.prizes(), expected.prizes())
+        assert_equal(route.centroid(), expected.centroid())
+
+    # The improved solution is locally optimal, so searching again should not
+    # modify any routes, and return the same solution.
+    assert_(ls(improved, CostEvaluator(1, 1, 0)) == improved)
+
+
+def test_local_search_objects_can_run_concurrently(rc208):
+    """
+    Tests that separate local search objects can be used from multiple threads
+    at the same time, and that this gives the same results as running them
+    one after the other.
+    """
+    cost_eval = CostEvaluator(20, 6, 0)
+    neighbours = compute_neighbours(rc208)
+
+    def improve(seed: int) -> Solution:
+        rng = RandomNumberGenerator(seed=seed)
+        ls = LocalSearch(rc208, rng, neighbours)
+        ls.add_node_operator(Exchange10(rc208))
+        ls.add_route_operator(SwapStar(rc208))
+
+        sol = Solution.make_random(rc208, rng)
+        return ls(sol, cost_eval)
+
+    seeds = list(range(4))
+    sequential = [improve(seed) for seed in seeds]
+
+    with ThreadPoolExecutor(max_workers=len(seeds)) as executor:
+        concurrent = list(executor.map(improve, seeds))
+
+    assert_(concurrent == sequential)
+
+
+def test_frozen_route_prefixes_are_not_changed(rc208):
+    """
+    Tests that the local search does not change the frozen prefix of a route,
+    that is, the part of the route up to and including its last frozen client.
+    Route operators should skip routes with frozen clients entirely.
+    """
+    rng = RandomNumberGenerator(seed=42)
+    ls = LocalSearch(rc208, rng, compute_neighbours(rc208))
+    ls.add_node_operator(Exchange10(rc208))
+    ls.add_node_operator(Exchange11(rc208))
+    ls.add_route_operator(SwapStar(rc208))
+
+    sol = Solution.make_random(rc208, rng)
+    routes = sol.routes()
+    prefix = routes[0].visits()[:3]  # freezes only the first three clients
+    whole = routes[1].visits()  # freezes the entire route
+
+    # It suffices to freeze the last client of each prefix. The clients
+    # before it in the same route are then frozen as well.
+    ls.set_frozen_clients([prefix[-1], whole[-1]])
+    assert_equal(ls.frozen_clients(), sorted([prefix[-1], whole[-1]]))
+
+    improved = ls(sol, CostEvaluator(20, 6, 0))
+    visits = [route.visits() for route in improved.routes()]
+    assert_(any(route[: len(prefix)] == prefix for route in visits))
+    assert_(whole in visits)
+
+    # After unfreezing, the search is free to change all routes again.
+    ls.set_frozen_clients([])
+    assert_equal(ls.frozen_clients(), [])
+
+
+def test_set_frozen_clients_raises_for_invalid_client(ok_small):
+    """
+    Tests that set_frozen_clients() raises when passed a depot or a client
+    index that is out of range.
+    """
+    rng = RandomNumberGenerator(seed=42)
+    ls = LocalSearch(ok_small, rng, compute_neighbours(ok_small))
+
+    with assert_raises(ValueError):
+        ls.set_frozen_clients([0])  # depot
+
+    with assert_raises(ValueError):
+        ls.set_frozen_clients([ok_small.num_locations])  # out of range
+
+
+def test_srex_same_as_crossover_then_search(rc208):
+    """
+    Tests that the fused crossover and search stage returns the same solution
+    as first performing SREX, and then searching around the offspring.
+    """
+    cost_eval = CostEvaluator(20, 6, 0)
+    neighbours = compute_neighbours(rc208)
+
+    fused_ls = LocalSearch(rc208, RandomNumberGenerator(42), neighbours)
+    fused_ls.add_node_operator(Exchange10(rc208))
+    fused_ls.add_route_operator(SwapStar(rc208))
+
+    rng = RandomNumberGenerator(42)
+    ls = LocalSearch(rc208, rng, neighbours)
+    ls.add_node_operator(Exchange10(rc208))
+    ls.add_route_operator(SwapStar(rc208))
+
+    parent_rng = RandomNumberGenerator(seed=1)
+    for _ in range(10):
+        parents = (
+            Solution.make_random(rc208, parent_rng),
+            Solution.make_random(rc208, parent_rng),
+        )
+
+        fused = fused_ls.srex(parents, cost_eval)
+        offspring = srex(parents, rc208, cost_eval, rng)
+        assert_equal(fused, ls(offspring, cost_eval))
+
+
+def _make_search(data: ProblemData, swap_star: SwapStar) -> cpp_LocalSearch:
+    ls = cpp_LocalSearch(data, compute_neighbours(data))
+    ls.add_node_operator(Exchange10(data))
+    ls.add_route_operator(swap_star)
+    return ls
+
+
+def test_reused_search_same_as_fresh_search(rc208):
+    """
+    Tests that a local search object that is reused on a sequence of
+    overlapping solutions, and thus keeps its loaded routes and route operator
+    caches between calls, returns the same solutions as a fresh search.
+    """
+    cost_eval = CostEvaluator(20, 6, 0)
+    rng = RandomNumberGenerator(seed=42)
+    ls = _make_search(rc208, SwapStar(rc208))
+
+    sol = Solution.make_random(rc208, rng)
+    for _ in range(10):
+        improved = ls(sol, cost_eval)
+        fresh = _make_search(rc208, SwapStar(rc208))
+        assert_equal(improved, fresh(sol, cost_eval))
+
+        # The next solution shares many of its routes with the improved one.
+        other = Solution.make_random(rc208, rng)
+        sol = srex((improved, other), rc208, cost_eval, rng)
+
+
+def test_route_operator_shared_between_searches(rc208):
+    """
+    Tests that a route operator that is shared between two local search
+    objects is re-initialised whenever the other search used it in the
+    meantime, so that neither search relies on the other's cached state.
+    """
+    cost_eval = CostEvaluator(20, 6, 0)
+    rng = RandomNumberGenerator(seed=42)
+
+    swap_star = SwapStar(rc208)
+    searches = [_make_search(rc208, swap_star) for _ in range(2)]
+
+    sol = Solution.make_random(rc208, rng)
+    for idx in range(10):
+        improved = searches[idx % 2](sol, cost_eval)
+        fresh = _make_search(rc208, SwapStar(rc208))
+        assert_equal(improved, fresh(sol, cost_eval))
+
+        other = Solution.make_random(rc208, rng)
+        sol = srex((improved, other), rc208, cost_eval, rng)
@@ -3,7 +3,11 @@ from numpy.testing import assert_, assert_equal, assert_raises
 from pytest import mark
 
 from pyvrp import VehicleType
-from pyvrp.search import NeighbourhoodParams, compute_neighbours
+from pyvrp.search import (
+    NeighbourhoodParams,
+    compute_neighbours,
+    extend_neighbours,
+)
 
 
 @mark.parametrize(
@@ -268,3 +272,53 @@ def test_multiple_routing_profiles(ok_small):
     # neighbourhood computations, resulting in the same neighbourhood as with
     # the original (unchanged) data.
     assert_equal(compute_neighbours(data), compute_neighbours(ok_small))
+
+
+@mark.parametrize(
+    ("nb_granular", "symmetric_proximity", "symmetric_neighbours"),
+    [
+        (10, True, False),
+        (10, False, False),
+        (10, True, True),
+        (1_000, True, False),  # more neighbours than there are clients
+    ],
+)
+@mark.parametrize("num_new", [1, 10])
+def test_extend_neighbours_same_as_compute_neighbours(
+    rc208,
+    nb_granular: int,
+    symmetric_proximity: bool,
+    symmetric_neighbours: bool,
+    num_new: int,
+):
+    """
+    Tests that extending the neighbourhood of an instance without its last
+    few clients results in the same neighbourhood as computing it for the full
+    instance from scratch.
+    """
+    num_locs = rc208.num_locations - num_new
+    old = rc208.replace(
+        clients=rc208.clients()[:-num_new],
+        distance_matrices=[rc208.distance_matrix(0)[:num_locs, :num_locs]],
+        duration_matrices=[rc208.duration_matrix(0)[:num_locs, :num_locs]],
+    )
+
+    params = NeighbourhoodParams(
+        nb_granular=nb_granular,
+        symmetric_proximity=symmetric_proximity,
+        symmetric_neighbours=symmetric_neighbours,
+    )
+
+    neighbours = compute_neighbours(old, params)
+    extended = extend_neighbours(rc208, neighbours, params)
+    assert_equal(extended, compute_neighbours(rc208, params))
+
+
+def test_extend_neighbours_raises_for_mismatched_data(ok_small, rc208):
+    """
+    Tests that extend_neighbours raises when the given neighbourhood has more
+    locations than the given data instance.
+    """
+    neighbours = compute_neighbours(rc208)
+    with assert_raises(ValueError):
+        extend_neighbours(ok_small, neighbours)
@@ -242,3 +242,30 @@ def test_unit_distance_duration_cost(ok_small):
     assert_equal(sol.distance_cost(), 31_729)
     assert_equal(sol.duration_cost(), 31_241)
     assert_equal(cost_eval.penalised_cost(sol), 31_729 + 31_241)
+
+
+def test_bulk_costs_match_individual_costs(ok_small):
+    """
+    Tests that the bulk penalised_costs() and costs() methods return the same
+    values as evaluating each solution separately.
+    """
+    cost_eval = CostEvaluator(20, 6, 0)
+    solutions = [
+        Solution(ok_small, [[1, 2], [3, 4]]),
+        Solution(ok_small, [[1, 2, 3, 4]]),
+        Solution(ok_small, [[2], [3, 4]]),
+    ]
+
+    penalised_costs = cost_eval.penalised_costs(solutions)
+    assert_equal(penalised_costs.shape, (len(solutions),))
+    assert_equal(
+        penalised_costs,
+        [cost_eval.penalised_cost(sol) for sol in solutions],
+    )
+
+    costs = cost_eval.costs(solutions)
+    assert_equal(costs, [cost_eval.cost(sol) for sol in solutions])
+
+    # Also for an empty list of solutions.
+    assert_equal(cost_eval.penalised_costs([]).shape, (0,))
+    assert_equal(cost_eval.costs([]).shape, (0,))
@@ -1,5 +1,3 @@
-from types import MethodType
-
 import numpy as np
 from numpy.testing import assert_, assert_allclose, assert_equal, assert_raises
 from pytest import mark
@@ -12,8 +10,10 @@ from pyvrp import (
     Population,
     PopulationParams,
     RandomNumberGenerator,
+    Route,
     Solution,
 )
+from pyvrp.crossover import AdaptiveCrossover
 from pyvrp.crossover import selective_route_exchange as srex
 from pyvrp.diversity import broken_pairs_distance as bpd
 from pyvrp.search import Exchange10, LocalSearch, compute_neighbours
@@ -229,27 +229,35 @@ def test_never_repairs_when_zero_repair_probability(rc208):
     probability parameter is set to zero.
     """
     rng = RandomNumberGenerator(seed=42)
-    pm = PenaltyManager(PenaltyParams(repair_booster=10))
     pop = Population(bpd)
 
+    # When asked for a booster cost evaluator (as used during repair), this
+    # penalty manager raises a runtime error once it is told to do so.
+    class BoosterPenaltyManager(PenaltyManager):
+        should_raise = False
+
+        def booster_cost_evaluator(self):
+            if self.should_raise:
+                raise RuntimeError
+
+            return super().booster_cost_evaluator()
+
+    pm = BoosterPenaltyManager(PenaltyParams(repair_booster=10))
+
     ls = LocalSearch(rc208, rng, compute_neighbours(rc208))
     ls.add_node_operator(Exchange10(rc208))
 
     init = [Solution.make_random(rc208, rng) for _ in range(25)]
 
-    # Repair probability 100%, but we're still using the unpatched penalty
-    # manager. This should be OK.
+    # Repair probability 100%, but the penalty manager does not raise yet.
+    # This should be OK.
     ga_params = GeneticAlgorithmParams(repair_probability=1.0)
     algo = GeneticAlgorithm(rc208, pm, rng, pop, ls, srex, init, ga_params)
     algo.run(MaxIterations(50))
 
-    # Now we patch the penalty manager: when asked for a booster cost evaluator
-    # (as used during repair), this will now raise a runtime error. Since the
-    # repair probability is still 100%, this should certainly raise.
-    def raise_when_called(self):
-        raise RuntimeError
-
-    pm.booster_cost_evaluator = MethodType(raise_when_called, pm)
+    # Now the penalty manager raises when asked for a booster cost evaluator.
+    # Since the repair probability is still 100%, this should certainly raise.
+    pm.should_raise = True
     with assert_raises(RuntimeError):
         algo.run(MaxIterations(50))
 
@@ -258,3 +266,170 @@ def test_never_repairs_when_zero_repair_probability(rc208):
     ga_params = GeneticAlgorithmParams(repair_probability=0.0)
     algo = GeneticAlgorithm(rc208, pm, rng, pop, ls, srex, init, ga_params)
     algo.run(MaxIterations(50))
+
+
+def test_register_routes(rc208):
+    """
+    Tests that the genetic algorithm registers the routes of each improved
+    offspring with the penalty manager when asked to, rather than the offspring
+    as a whole.
+    """
+    rng = RandomNumberGenerator(seed=42)
+    pop = Population(bpd)
+
+    ls = LocalSearch(rc208, rng, compute_neighbours(rc208))
+    ls.add_node_operator(Exchange10(rc208))
+
+    init = [Solution.make_random(rc208, rng) for _ in range(25)]
+
+    num_solutions = num_routes = 0
+
+    class CountingPenaltyManager(PenaltyManager):
+        def register(self, sol):
+            nonlocal num_solutions
+            num_solutions += 1
+
+        def register_route(self, route):
+            nonlocal num_routes
+            num_routes += 1
+
+    pm = CountingPenaltyManager()
+
+    # By default, the genetic algorithm registers entire solutions.
+    ga_params = GeneticAlgorithmParams(repair_probability=0)
+    algo = GeneticAlgorithm(rc208, pm, rng, pop, ls, srex, init, ga_params)
+    algo.run(MaxIterations(10))
+
+    assert_equal(num_solutions, 10)
+    assert_equal(num_routes, 0)
+
+    # But when asked to, it registers each route of those solutions instead.
+    num_solutions = 0
+    ga_params = GeneticAlgorithmParams(
+        repair_probability=0,
+        register_routes=True,
+    )
+    algo = GeneticAlgorithm(rc208, pm, rng, pop, ls, srex, init, ga_params)
+    algo.run(MaxIterations(10))
+
+    assert_equal(num_solutions, 0)
+    assert_(num_routes >= 10)
+
+
+@mark.parametrize(
+    ("nb_iter_route_pool", "route_pool_size"),
+    [
+        (-1, 1),  # nb_iter_route_pool < 0
+        (0, 0),  # route_pool_size == 0
+        (1, -1),  # route_pool_size < 0
+    ],
+)
+def test_params_constructor_raises_when_route_pool_arguments_invalid(
+    nb_iter_route_pool: int,
+    route_pool_size: int,
+):
+    """
+    Tests that invalid route pool configurations are not accepted.
+    """
+    with assert_raises(ValueError):
+        GeneticAlgorithmParams(
+            nb_iter_route_pool=nb_iter_route_pool,
+            route_pool_size=route_pool_size,
+        )
+
+
+def test_route_pool_stage_adds_combined_solutions(ok_small):
+    """
+    Tests that the route pool stage adds the (improved) combined pool solution
+    to the population.
+    """
+    rng = RandomNumberGenerator(seed=42)
+    pm = PenaltyManager()
+    pop = Population(bpd)
+    init = [Solution.make_random(ok_small, rng) for _ in range(25)]
+
+    combined = []
+
+    def search(sol, cost_eval):
+        combined.append(sol)
+        return sol
+
+    params = GeneticAlgorithmParams(repair_probability=0, nb_iter_route_pool=1)
+    algo = GeneticAlgorithm(ok_small, pm, rng, pop, search, srex, init, params)
+    algo.run(MaxIterations(10))
+
+    # Each iteration searches around one offspring solution, and one solution
+    # combined from the route pool.
+    assert_equal(len(combined), 20)
+
+
+def test_frozen_routes_are_kept(ok_small):
+    """
+    Tests that every solution the genetic algorithm produces contains the
+    frozen routes, also when the initial solutions do not.
+    """
+    pm = PenaltyManager()
+    rng = RandomNumberGenerator(seed=42)
+    pop = Population(bpd)
+    ls = LocalSearch(ok_small, rng, compute_neighbours(ok_small))
+    ls.add_node_operator(Exchange10(ok_small))
+    ls.set_frozen_clients([3])
+
+    frozen = Route(ok_small, [3], vehicle_type=0)
+    init = [Solution.make_random(ok_small, rng) for _ in range(25)]
+    algo = GeneticAlgorithm(
+        ok_small, pm, rng, pop, ls, srex, init, frozen_routes=[frozen]
+    )
+
+    res = algo.run(MaxIterations(25))
+    assert_(any(route.visits()[:1] == [3] for route in res.best.routes()))
+
+    for sol in pop:
+        assert_(any(route.visits()[:1] == [3] for route in sol.routes()))
+
+
+def test_raises_when_frozen_routes_use_too_many_vehicles(ok_small):
+    """
+    Tests that the genetic algorithm raises when the frozen routes require
+    more vehicles than are available.
+    """
+    pm = PenaltyManager()
+    rng = RandomNumberGenerator(seed=42)
+    pop = Population(bpd)
+    ls = LocalSearch(ok_small, rng, compute_neighbours(ok_small))
+    init = [Solution.make_random(ok_small, rng)]
+
+    num_available = ok_small.vehicle_type(0).num_available
+    frozen = [
+        Route(ok_small, [client], vehicle_type=0)
+        for client in range(1, num_available + 2)
+    ]
+
+    with assert_raises(ValueError):
+        GeneticAlgorithm(
+            ok_small, pm, rng, pop, ls, srex, init, frozen_routes=frozen
+        )
+
+
+def test_adaptive_crossover_is_updated_each_iteration(ok_small):
+    """
+    Tests that the genetic algorithm reports back to an adaptive crossover
+    operator after each offspring.
+    """
+    pm = PenaltyManager()
+    rng = RandomNumberGenerator(seed=42)
+    pop = Population(bpd)
+    ls = LocalSearch(ok_small, rng, compute_neighbours(ok_small))
+    ls.add_node_operator(Exchange10(ok_small))
+
+    crossover = AdaptiveCrossover.srex_variants(max_moved_routes=2)
+    init = [Solution.make_random(ok_small, rng) for _ in range(25)]
+    algo = GeneticAlgorithm(ok_small, pm, rng, pop, ls, crossover, init)
+    algo.run(MaxIterations(20))
+
+    # Each of the four variants is tried at least once, and every iteration
+    # results in exactly one update.
+    num_updates = crossover.selector.num_updates()
+    assert_equal(sum(num_updates), 20)
+    assert_(all(num > 0 for num in num_updates))
+    assert_(all(duration >= 0 for duration in crossover.selector.durations()))
@@ -1,8 +1,25 @@
+import copy
+import pickle
+
 import numpy as np
 import pytest
-from numpy.testing import assert_, assert_equal, assert_raises, assert_warns
+from numpy.testing import (
+    assert_,
+    assert_allclose,
+    assert_equal,
+    assert_raises,
+    assert_warns,
+)
 
-from pyvrp import PenaltyManager, PenaltyParams, Solution, VehicleType
+from pyvrp import (
+    Client,
+    PenaltyManager,
+    PenaltyParams,
+    Solution,
+    VehicleType,
+)
+from pyvrp._pyvrp import average_best_edges
+from pyvrp.constants import MAX_VALUE
 from pyvrp.exceptions import PenaltyBoundWarning
 
 
@@ -46,6 +63,35 @@ def test_constructor_throws_when_arguments_invalid(
         )
 
 
+def test_penalty_params_pickle_and_copy():
+    """
+    Tests that penalty parameters survive a pickle round-trip and can be
+    (deep)copied, since they are part of the (picklable) solver parameters.
+    """
+    params = PenaltyParams(5, 25, 1.5, 0.5, 0.6)
+
+    after_pickle = pickle.loads(pickle.dumps(params))
+    assert_equal(after_pickle, params)
+    assert_equal(after_pickle.repair_booster, 5)
+    assert_equal(after_pickle.solutions_between_updates, 25)
+    assert_equal(after_pickle.target_feasible, 0.6)
+
+    assert_equal(copy.copy(params), params)
+    assert_equal(copy.deepcopy(params), params)
+
+
+def test_penalty_params_repr():
+    """
+    Tests that the representation of the penalty parameters lists each field.
+    """
+    params = PenaltyParams(5, 25, 1.5, 0.5, 0.6)
+    assert_equal(
+        repr(params),
+        "PenaltyParams(repair_booster=5, solutions_between_updates=25, "
+        "penalty_increase=1.5, penalty_decrease=0.5, target_feasible=0.6)",
+    )
+
+
 def test_repair_booster():
     """
     Tests that the booster evaluator returns a cost evaluator object that
@@ -401,3 +447,76 @@ def test_init_clips_penalties():
     assert_equal(cost_eval.load_penalty(1, 0), 1)  # set to MIN
     assert_equal(cost_eval.tw_penalty(1), PenaltyManager.MAX_PENALTY)  # MAX
     assert_equal(cost_eval.dist_penalty(1, 0), 2)  # already OK, so unchanged
+
+
+def test_average_best_edges_multiple_profiles_and_vehicle_types(
+    ok_small_two_profiles,
+):
+    """
+    Tests that average_best_edges() computes the averages of the best edge
+    cost, distance, and duration over all vehicle types and profiles, just
+    like computing the elementwise minimum of the full matrices would.
+    """
+    data = ok_small_two_profiles.replace(
+        vehicle_types=[
+            VehicleType(1, 10, profile=0, unit_distance_cost=3),
+            VehicleType(1, 10, profile=1, unit_duration_cost=2),
+            VehicleType(1, 10, profile=1, unit_duration_cost=2),  # duplicate
+        ]
+    )
+
+    distances = data.distance_matrices()
+    durations = data.duration_matrices()
+    edge_costs = [3 * distances[0], distances[1] + 2 * durations[1]]
+
+    avg_cost, avg_distance, avg_duration = average_best_edges(data)
+    assert_allclose(avg_cost, np.minimum.reduce(edge_costs).mean())
+    assert_allclose(avg_distance, np.minimum.reduce(distances).mean())
+    assert_allclose(avg_duration, np.minimum.reduce(durations).mean())
+
+
+def test_average_best_edges_does_not_overflow(ok_small):
+    """
+    Tests that average_best_edges() does not overflow when the matrices contain
+    many very large values, as they do for edges that cannot be traversed. The
+    sum of a single row of this instance exceeds the largest integer value.
+    """
+    num_locs = 2_100
+    distances = np.full((num_locs, num_locs), MAX_VALUE, dtype=np.int64)
+    np.fill_diagonal(distances, 0)
+
+    data = ok_small.replace(
+        clients=[Client(x=0, y=0) for _ in range(num_locs - 1)],
+        distance_matrices=[distances],
+        duration_matrices=[np.zeros_like(distances)],
+    )
+
+    expected = MAX_VALUE * (num_locs - 1) / num_locs
+    avg_cost, avg_distance, avg_duration = average_best_edges(data)
+    assert_allclose(avg_cost, expected)
+    assert_allclose(avg_distance, expected)
+    assert_equal(avg_duration, 0)
+
+
+def test_register_route(ok_small):
+    """
+    Tests that registering routes updates the penalties based on the fraction
+    of feasible routes, rather than the fraction of feasible solutions.
+    """
+    params = PenaltyParams(1, 2, 1.1, 0.9, 0.5)
+    pm = PenaltyManager(params, initial_penalties=(100, 1, 1))
+
+    sol = Solution(ok_small, [[1, 2, 3], [4]])
+    assert_(sol.has_excess_load())
+
+    # One of the two routes is load infeasible, which is exactly on target. So
+    # the load penalty should not change.
+    for route in sol.routes():
+        pm.register_route(route)
+    assert_equal(pm.penalties()[0], 100)
+
+    # But the solution as a whole is load infeasible, so registering it twice
+    # should increase the load penalty.
+    pm.register(sol)
+    pm.register(sol)
+    assert_equal(pm.penalties()[0], 111)
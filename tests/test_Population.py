@@ -318,10 +318,10 @@ def test_tournament_raises_for_invalid_k(rc208, k: int):
         pop.tournament(rng, cost_evaluator, k=k)
 
 
-def test_purge_removes_duplicates(rc208):
+def test_add_rejects_duplicates(rc208):
     """
-    Tests that purging/survivor selection first removes duplicate solutions,
-    before purging by (biased) fitness.
+    Tests that adding a solution that is already in the population does not
+    add it again.
     """
     cost_evaluator = CostEvaluator(20, 6, 0)
     params = PopulationParams(min_pop_size=5, generation_size=20)
@@ -333,23 +333,18 @@ def test_purge_removes_duplicates(rc208):
 
     assert_equal(len(pop), params.min_pop_size - 1)
 
-    # This is the solution we are going to add a few times. That should make
-    # sure the relevant subpopulation definitely contains duplicates.
+    # This is the solution we are going to add a few times. Only the first
+    # time should actually add it to the population.
     sol = Solution.make_random(rc208, rng)
-    assert_(not sol.is_feasible())
-
     for _ in range(params.generation_size):
         pop.add(sol, cost_evaluator)
 
-    # Keep adding the solution until we have had a purge, and returned to the
-    # minimum population size. Note that the purge is done after adding the
-    # solution, so we must add the same solution in order to have at most
-    # min_pop_size - 1 other solutions than the duplicated solution.
-    while pop.num_infeasible() != params.min_pop_size:
-        pop.add(sol, cost_evaluator)
+    assert_equal(len(pop), params.min_pop_size)
+
+    # An identical copy of the solution should not be added either.
+    pop.add(Solution(rc208, sol.routes()), cost_evaluator)
+    assert_equal(len(pop), params.min_pop_size)
 
-    # Since duplicates are purged first, there should now be only one of them
-    # in the subpopulation.
     duplicates = sum(other == sol for other in pop)
     assert_equal(duplicates, 1)
 
@@ -209,7 +209,8 @@ def test_problem_data_raises_matrix_diagonal_nonzero(dist_mat, dur_mat):
 def test_problem_data_replace_no_changes():
     """
     Tests that when using ``ProblemData.replace()`` without any arguments
-    returns a new instance with different objects, but with the same values.
+    returns a new instance with the same values. Since nothing is replaced,
+    the new instance shares its data with the original instance.
     """
     clients = [Client(x=0, y=0)]
     depots = [Depot(x=0, y=0)]
@@ -222,7 +223,6 @@ def test_problem_data_replace_no_changes():
     assert_(new is not original)
 
     for idx in range(new.num_clients):
-        assert_(new.location(idx) is not original.location(idx))
         assert_equal(new.location(idx).x, original.location(idx).x)
         assert_equal(new.location(idx).y, original.location(idx).y)
 
@@ -230,18 +230,17 @@ def test_problem_data_replace_no_changes():
         new_veh_type = new.vehicle_type(idx)
         og_veh_type = original.vehicle_type(idx)
 
-        assert_(new_veh_type is not og_veh_type)
         assert_equal(new_veh_type.capacity, og_veh_type.capacity)
         assert_equal(new_veh_type.num_available, og_veh_type.num_available)
 
     new_dist = new.distance_matrix(profile=0)
     orig_dist = original.distance_matrix(profile=0)
-    assert_(new_dist is not orig_dist)
+    assert_(np.shares_memory(new_dist, orig_dist))
     assert_equal(new_dist, orig_dist)
 
     new_dur = new.duration_matrix(profile=0)
     orig_dur = original.duration_matrix(profile=0)
-    assert_(new_dur is not orig_dur)
+    assert_(np.shares_memory(new_dur, orig_dur))
     assert_equal(new_dur, orig_dur)
 
     assert_equal(new.num_clients, original.num_clients)
@@ -285,8 +284,13 @@ def test_problem_data_replace_with_changes():
     with assert_raises(AssertionError):
         assert_equal(new.distance_matrix(0), original.distance_matrix(0))
 
+    # The duration matrix was not replaced, and is thus shared with the
+    # original instance rather than copied.
     assert_(new.duration_matrix(0) is not original.duration_matrix(0))
     assert_equal(new.duration_matrix(0), original.duration_matrix(0))
+    assert_(
+        np.shares_memory(new.duration_matrix(0), original.duration_matrix(0))
+    )
 
     assert_equal(new.num_clients, original.num_clients)
     assert_(new.num_vehicle_types != original.num_vehicle_types)
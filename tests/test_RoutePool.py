@@ -0,0 +1,162 @@
+from numpy.testing import assert_, assert_equal, assert_raises
+
+from pyvrp import CostEvaluator, Route, RoutePool, Solution
+from tests.helpers import read_solution
+
+
+def test_raises_when_max_size_zero(ok_small):
+    """
+    Tests that the route pool cannot be constructed with zero capacity.
+    """
+    with assert_raises(ValueError):
+        RoutePool(ok_small, max_size=0)
+
+    pool = RoutePool(ok_small, max_size=1)
+    assert_equal(pool.max_size, 1)
+
+
+def test_add_stores_distinct_feasible_routes(ok_small):
+    """
+    Tests that adding solutions stores each distinct feasible route only once,
+    and skips infeasible routes.
+    """
+    pool = RoutePool(ok_small)
+    assert_equal(len(pool), 0)
+
+    feas = Solution(ok_small, [[1, 2], [3], [4]])
+    assert_(all(route.is_feasible() for route in feas.routes()))
+
+    pool.add(feas)
+    assert_equal(len(pool), 3)
+
+    pool.add(feas)  # adding the same routes again should not change the pool
+    assert_equal(len(pool), 3)
+
+    # This solution's only route is infeasible due to excess load, so it
+    # should not be added to the pool.
+    infeas = Solution(ok_small, [[1, 2, 3, 4]])
+    assert_(infeas.has_excess_load())
+
+    pool.add(infeas)
+    assert_equal(len(pool), 3)
+
+    pool.clear()
+    assert_equal(len(pool), 0)
+
+
+def test_add_skips_empty_routes(ok_small):
+    """
+    Tests that empty routes are never added to the pool. Solutions normally do
+    not have empty routes, but unpickling does not check that.
+    """
+    sol = Solution(ok_small, [[1, 2]])
+    state = list(sol.__getstate__())
+    state[13] = [Route(ok_small, [], vehicle_type=0), *state[13]]
+
+    tampered = Solution.__new__(Solution)
+    tampered.__setstate__(tuple(state))
+    assert_equal(len(tampered.routes()), 2)
+
+    pool = RoutePool(ok_small)
+    pool.add(tampered)
+    assert_equal(len(pool), 1)
+
+    # Combining should not fail on the pooled routes, and can only use the
+    # single non-empty route.
+    combined = pool.combine()
+    assert_(all(len(route) > 0 for route in combined.routes()))
+    assert_(combined.num_routes() <= 1)
+
+
+def test_max_size_evicts_least_recently_seen(ok_small):
+    """
+    Tests that the pool removes the least recently seen routes once it grows
+    beyond its maximum size.
+    """
+    pool = RoutePool(ok_small, max_size=2)
+
+    pool.add(Solution(ok_small, [[1, 2]]))
+    pool.add(Solution(ok_small, [[3, 4]]))
+    assert_equal(len(pool), 2)
+
+    # Routes [1, 2] and [3, 4] are now the least recently seen. The new
+    # solution's routes should replace them.
+    pool.add(Solution(ok_small, [[2, 1], [4, 3]]))
+    assert_equal(len(pool), 2)
+
+    # Hence the best combination uses only the most recent routes.
+    combined = pool.combine()
+    visits = sorted(route.visits() for route in combined.routes())
+    assert_equal(visits, [[2, 1], [4, 3]])
+
+
+def test_combine_returns_disjoint_routes(ok_small):
+    """
+    Tests that combining pool routes results in a valid solution of disjoint
+    routes, all of which come from the pool.
+    """
+    pool = RoutePool(ok_small)
+    pool.add(Solution(ok_small, [[1, 2], [3], [4]]))
+    pool.add(Solution(ok_small, [[2, 3], [1, 4]]))
+    pool.add(Solution(ok_small, [[3, 4]]))
+
+    pool_routes = [
+        [1, 2],
+        [3],
+        [4],
+        [2, 3],
+        [1, 4],
+        [3, 4],
+    ]
+
+    combined = pool.combine()
+    for route in combined.routes():
+        assert_(route.visits() in pool_routes)
+
+    # The routes are disjoint (else the solution could not be constructed),
+    # and there are enough vehicles to visit all clients.
+    assert_(combined.is_complete())
+    assert_(combined.is_feasible())
+
+
+def test_combine_recovers_added_solution(rc208):
+    """
+    Tests that combining the routes of a single good solution results in that
+    same solution.
+    """
+    bks = Solution(rc208, read_solution("data/RC208.sol"))
+
+    pool = RoutePool(rc208)
+    pool.add(bks)
+    assert_equal(len(pool), bks.num_routes())
+    assert_equal(pool.combine(), bks)
+
+
+def test_combine_improves_over_added_solutions(ok_small):
+    """
+    Tests that the pool can combine routes from different solutions into a
+    solution that is better than each of those solutions.
+    """
+    # The best solution to this instance uses routes [1, 2], and [3, 4]. We
+    # add two solutions, each of which contains one of these routes.
+    sol1 = Solution(ok_small, [[1, 2], [3], [4]])
+    sol2 = Solution(ok_small, [[1], [2], [3, 4]])
+
+    pool = RoutePool(ok_small)
+    pool.add(sol1)
+    pool.add(sol2)
+
+    cost_eval = CostEvaluator(20, 6, 0)
+    combined = pool.combine()
+    assert_(cost_eval.cost(combined) < cost_eval.cost(sol1))
+    assert_(cost_eval.cost(combined) < cost_eval.cost(sol2))
+
+
+def test_combine_empty_pool(ok_small):
+    """
+    Tests that combining an empty pool returns an empty solution.
+    """
+    pool = RoutePool(ok_small)
+    combined = pool.combine()
+    assert_equal(combined.num_routes(), 0)
+    assert_equal(combined.num_missing_clients(), ok_small.num_clients)
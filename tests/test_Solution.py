@@ -298,6 +298,25 @@ def test_feasibility(ok_small):
     assert_(not sol.has_time_warp())
 
 
+def test_are_feasible(ok_small):
+    """
+    Tests that the bulk are_feasible() method returns the same feasibility
+    flags as checking each solution separately.
+    """
+    solutions = [
+        Solution(ok_small, [[1, 2, 3, 4]]),
+        Solution(ok_small, [[1, 2], [3], [4]]),
+        Solution(ok_small, [[1, 2], [3]]),
+    ]
+
+    feasible = Solution.are_feasible(solutions)
+    assert_equal(feasible.dtype, np.bool_)
+    assert_equal(feasible, [False, True, False])
+    assert_equal(feasible, [sol.is_feasible() for sol in solutions])
+
+    assert_equal(Solution.are_feasible([]).shape, (0,))
+
+
 def test_feasibility_release_times():
     """
     Tests solutions can be infeasible due to release time violations, which
@@ -721,6 +740,26 @@ def test_hash(ok_small):
     assert_equal(hash(sol2), hash(sol3))
 
 
+def test_hash_depends_on_neighbour_structure(ok_small):
+    """
+    Tests that the hash is based on the neighbour structure of the solution:
+    the order of the routes does not matter, but the order of the visits does.
+    """
+    sol1 = Solution(ok_small, [[1, 2], [3, 4]])
+    sol2 = Solution(ok_small, [[3, 4], [1, 2]])
+    assert_equal(sol1, sol2)
+    assert_equal(hash(sol1), hash(sol2))
+
+    # Same routes, but the second one is reversed. That is a different
+    # solution, so the hash should also be different.
+    sol3 = Solution(ok_small, [[1, 2], [4, 3]])
+    assert_(sol1 != sol3)
+    assert_(hash(sol1) != hash(sol3))
+
+    # The hash should survive pickling.
+    assert_equal(hash(pickle.loads(pickle.dumps(sol3))), hash(sol3))
+
+
 def test_solution_can_be_pickled(ok_small):
     """
     Tests that a solution can be serialised and unserialised.
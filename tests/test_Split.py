@@ -0,0 +1,109 @@
+from numpy.testing import assert_, assert_equal, assert_raises
+from pytest import mark
+
+from pyvrp import CostEvaluator, Route, Solution, VehicleType
+from pyvrp._pyvrp import split
+
+
+def _best_split_cost(data, tour, cost_eval, max_routes):
+    """
+    Computes the cost of the best split of the given tour into at most the
+    given number of routes, by evaluating every possible route.
+    """
+    inf = float("inf")
+    costs = [[inf] * (len(tour) + 1) for _ in range(max_routes + 1)]
+    costs[0][0] = 0
+
+    for num_routes in range(max_routes):
+        for start, cost in enumerate(costs[num_routes]):
+            if cost == inf:
+                continue
+
+            for end in range(start + 1, len(tour) + 1):
+                route = Route(data, tour[start:end], vehicle_type=0)
+                sol = Solution(data, [route])
+                route_cost = cost + cost_eval.penalised_cost(sol)
+
+                new_costs = costs[num_routes + 1]
+                new_costs[end] = min(new_costs[end], route_cost)
+
+    return min(costs[num_routes][-1] for num_routes in range(max_routes + 1))
+
+
+def test_raises_for_non_client_locations(ok_small):
+    """
+    Tests that split raises when the tour contains depots, or locations that
+    do not exist.
+    """
+    cost_eval = CostEvaluator(20, 6, 0)
+
+    with assert_raises(ValueError):
+        split(ok_small, [0, 1, 2], cost_eval)
+
+    with assert_raises(ValueError):
+        split(ok_small, [1, 2, ok_small.num_locations], cost_eval)
+
+
+def test_empty_tour(ok_small):
+    """
+    Tests that splitting an empty tour results in no routes.
+    """
+    assert_equal(split(ok_small, [], CostEvaluator(20, 6, 0)), [])
+
+
+@mark.parametrize("num_available", [21, 5, 3, 1])
+def test_capacity_only_split_is_optimal(small_cvrp, num_available: int):
+    """
+    Tests that split returns the best split of the tour, also when the number
+    of available vehicles limits the number of routes. The instance is a CVRP,
+    so this uses the linear time split algorithm.
+    """
+    capacity = small_cvrp.vehicle_type(0).capacity
+    vehicle_type = VehicleType(num_available, capacity=capacity)
+    data = small_cvrp.replace(vehicle_types=[vehicle_type])
+
+    cost_eval = CostEvaluator(20, 6, 0)
+    tour = list(range(data.num_depots, data.num_locations))
+    routes = split(data, tour, cost_eval)
+
+    # The routes should visit the clients in tour order, and not use more
+    # vehicles than are available.
+    assert_equal([client for route in routes for client in route], tour)
+    assert_(len(routes) <= num_available)
+
+    sol = Solution(data, routes)
+    best_cost = _best_split_cost(data, tour, cost_eval, num_available)
+    assert_equal(cost_eval.penalised_cost(sol), best_cost)
+
+
+def test_split_with_time_windows(ok_small):
+    """
+    Tests that split also works with time windows, where it should find the
+    best split of this small tour.
+    """
+    cost_eval = CostEvaluator(20, 6, 0)
+    tour = [4, 3, 2, 1]
+    routes = split(ok_small, tour, cost_eval)
+
+    assert_equal([client for route in routes for client in route], tour)
+    assert_(len(routes) <= ok_small.num_vehicles)
+
+    sol = Solution(ok_small, routes)
+    best_cost = _best_split_cost(ok_small, tour, cost_eval, 3)
+    assert_equal(cost_eval.penalised_cost(sol), best_cost)
+
+
+def test_respects_available_vehicles_of_each_type(ok_small):
+    """
+    Tests that split does not use more vehicles of a vehicle type than there
+    are available.
+    """
+    vehicle_types = [VehicleType(1, capacity=10), VehicleType(1, capacity=5)]
+    data = ok_small.replace(vehicle_types=vehicle_types)
+
+    cost_eval = CostEvaluator(1_000, 6, 0)
+    routes = split(data, [1, 2, 3, 4], cost_eval)
+
+    vehicle_types = [route.vehicle_type() for route in routes]
+    assert_equal(len(set(vehicle_types)), len(vehicle_types))
+    assert_equal(sum(len(route) for route in routes), 4)
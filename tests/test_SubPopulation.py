@@ -160,3 +160,74 @@ def test_fitness_is_average_of_cost_and_diversity_when_no_elites(rc208):
     # agree with what we've computed above.
     assert_(((actual_fitness >= 0) & (actual_fitness <= 1)).all())
     assert_allclose(actual_fitness, expected_fitness)
+
+
+def test_purge_removes_worst_fitness_in_one_batch(rc208):
+    """
+    Tests that purging computes the fitness once, and then removes all
+    solutions with the worst fitness values in a single batch.
+    """
+    cost_evaluator = CostEvaluator(20, 6, 0)
+    rng = RandomNumberGenerator(seed=53)
+    params = PopulationParams(min_pop_size=10, generation_size=15)
+    subpop = SubPopulation(bpd, params)
+
+    for _ in range(params.max_pop_size):
+        subpop.add(Solution.make_random(rc208, rng), cost_evaluator)
+
+    assert_equal(len(subpop), params.max_pop_size)
+
+    # Determine which solutions should survive the purge, based on the fitness
+    # values before purging: all but the generation_size worst ones.
+    subpop.update_fitness(cost_evaluator)
+    fitness = np.array([item.fitness for item in subpop])
+    worst = np.argsort(-fitness, kind="stable")[: params.generation_size]
+    survivors = [
+        item.solution for idx, item in enumerate(subpop) if idx not in worst
+    ]
+
+    subpop.purge(cost_evaluator)
+    assert_equal(len(subpop), params.min_pop_size)
+
+    # The survivors should be exactly the fittest solutions, and the proximity
+    # structures should be updated to reflect the removed solutions.
+    remaining = [item.solution for item in subpop]
+    assert_equal(sorted(map(hash, remaining)), sorted(map(hash, survivors)))
+
+    for item in subpop:
+        dists = [bpd(item.solution, other) for other in remaining]
+        closest = sorted(dists)[1 : params.nb_close + 1]  # skip self
+        assert_allclose(item.avg_distance_closest(), np.mean(closest))
+
+
+def test_solutions_held_across_purge_are_unchanged(rc208):
+    """
+    Tests that a solution obtained from the subpopulation, like the parents
+    selected by the genetic algorithm, is not affected when it is purged from
+    the subpopulation, and new solutions are added afterwards.
+    """
+    cost_evaluator = CostEvaluator(20, 6, 0)
+    rng = RandomNumberGenerator(seed=42)
+    params = PopulationParams(min_pop_size=5, generation_size=5)
+    subpop = SubPopulation(bpd, params)
+
+    for _ in range(params.max_pop_size):
+        subpop.add(Solution.make_random(rc208, rng), cost_evaluator)
+
+    held = [item.solution for item in subpop]
+    routes = [[route.visits() for route in sol.routes()] for sol in held]
+    costs = [cost_evaluator.penalised_cost(sol) for sol in held]
+    hashes = [hash(sol) for sol in held]
+
+    # These additions trigger several purges, which remove at least some of
+    # the held solutions from the subpopulation.
+    for _ in range(2 * params.max_pop_size):
+        subpop.add(Solution.make_random(rc208, rng), cost_evaluator)
+
+    remaining = {hash(item.solution) for item in subpop}
+    assert_(any(hash_ not in remaining for hash_ in hashes))
+
+    for idx, sol in enumerate(held):
+        assert_equal([route.visits() for route in sol.routes()], routes[idx])
+        assert_equal(cost_evaluator.penalised_cost(sol), costs[idx])
+        assert_equal(hash(sol), hashes[idx])
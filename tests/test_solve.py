@@ -1,8 +1,15 @@
-from numpy.testing import assert_, assert_equal
+import copy
+import pickle
 
+import numpy as np
+from numpy.testing import assert_, assert_equal, assert_raises
+
+from pyvrp import Client, CostEvaluator, Solution, VehicleType
 from pyvrp.GeneticAlgorithm import GeneticAlgorithmParams
 from pyvrp.PenaltyManager import PenaltyParams
 from pyvrp.Population import PopulationParams
+from pyvrp.construct import savings, sweep
+from pyvrp.crossover import giant_tour_crossover
 from pyvrp.search import (
     NODE_OPERATORS,
     ROUTE_OPERATORS,
@@ -11,7 +18,7 @@ from pyvrp.search import (
     SwapStar,
     SwapTails,
 )
-from pyvrp.solve import SolveParams, solve
+from pyvrp.solve import SolveParams, Solver, solve
 from pyvrp.stop import MaxIterations
 from tests.helpers import DATA_DIR
 
@@ -28,6 +35,19 @@ def test_default_values():
     assert_equal(params.neighbourhood, NeighbourhoodParams())
     assert_equal(params.node_ops, NODE_OPERATORS)
     assert_equal(params.route_ops, ROUTE_OPERATORS)
+    assert_(params.crossover_op is None)
+    assert_(params.construct_op is None)
+
+
+def test_solve_params_pickle_and_copy():
+    """
+    Tests that solver parameters, including the penalty parameters, can be
+    pickled and deep-copied.
+    """
+    params = SolveParams(penalty=PenaltyParams(repair_booster=5))
+
+    assert_equal(pickle.loads(pickle.dumps(params)), params)
+    assert_equal(copy.deepcopy(params), params)
 
 
 def test_solve_params_from_file():
@@ -49,6 +69,8 @@ def test_solve_params_from_file():
     assert_equal(params.neighbourhood, neighbourhood)
     assert_equal(params.node_ops, node_ops)
     assert_equal(params.route_ops, route_ops)
+    assert_(params.crossover_op is giant_tour_crossover)
+    assert_(params.construct_op is savings)
 
 
 def test_solve_params_from_file_defaults():
@@ -113,3 +135,192 @@ def test_solve_custom_params(ok_small):
 
     assert_(max_feas_size <= max_pop_size)
     assert_(max_infeas_size <= max_pop_size)
+
+
+def test_solve_custom_crossover_op(ok_small):
+    """
+    Tests that the solver uses the given crossover operator, rather than the
+    default one.
+    """
+    calls = 0
+
+    def crossover_op(*args):
+        nonlocal calls
+        calls += 1
+        return giant_tour_crossover(*args)
+
+    params = SolveParams(crossover_op=crossover_op)
+    res = solve(ok_small, stop=MaxIterations(10), seed=0, params=params)
+
+    assert_(res.best.is_feasible())
+    assert_(calls > 0)
+
+
+def test_solve_custom_construct_op(ok_small):
+    """
+    Tests that the solver uses the given construction heuristic to generate
+    the initial population.
+    """
+    calls = 0
+
+    def construct_op(data, cost_eval, rng, neighbours):
+        nonlocal calls
+        calls += 1
+        assert_equal(len(neighbours), data.num_locations)
+        return sweep(data, cost_eval, rng, neighbours)
+
+    pop_params = PopulationParams(min_pop_size=5)
+    params = SolveParams(population=pop_params, construct_op=construct_op)
+    res = solve(ok_small, stop=MaxIterations(10), seed=0, params=params)
+
+    assert_(res.best.is_feasible())
+    assert_(calls >= pop_params.min_pop_size)
+
+
+def test_solve_savings_construct_op(ok_small):
+    """
+    Tests that the solver passes its neighbourhood to the savings heuristic,
+    which needs it to determine which routes to merge.
+    """
+    params = SolveParams(construct_op=savings)
+    res = solve(ok_small, stop=MaxIterations(10), seed=0, params=params)
+    assert_(res.best.is_feasible())
+
+
+def test_solver_raises_invalid_num_workers(ok_small):
+    """
+    Tests that the solver raises when the number of workers is not positive.
+    """
+    with assert_raises(ValueError):
+        Solver(ok_small, num_workers=0)
+
+
+def test_solver_serves_multiple_requests(ok_small):
+    """
+    Tests that a solver object can serve multiple solve requests, both one at
+    a time and concurrently.
+    """
+    with Solver(ok_small, num_workers=2) as solver:
+        res = solver.solve(MaxIterations(10), seed=1)
+        assert_(res.is_feasible())
+        assert_equal(res.num_iterations, 10)
+
+        futures = [
+            solver.submit(MaxIterations(10), seed=seed) for seed in range(4)
+        ]
+
+        for future in futures:
+            res = future.result()
+            assert_(res.is_feasible())
+            assert_equal(res.num_iterations, 10)
+
+
+def test_solver_warm_start(ok_small):
+    """
+    Tests that the solver uses the given initial solutions. When no iterations
+    are performed, the best solution must then be at least as good as the
+    (feasible) initial solution.
+    """
+    init = Solution(ok_small, [[1, 2], [3], [4]])
+    assert_(init.is_feasible())
+
+    with Solver(ok_small) as solver:
+        res = solver.solve(MaxIterations(0), initial_solutions=[init])
+        assert_(res.cost() <= CostEvaluator(0, 0, 0).cost(init))
+
+
+def test_solver_add_clients(ok_small):
+    """
+    Tests that the solver can be updated with new clients, and that it then
+    transfers the given solutions to the new instance by inserting the new
+    clients into them.
+    """
+    num_locs = ok_small.num_locations - 1  # without the last client
+    old = ok_small.replace(
+        clients=ok_small.clients()[:-1],
+        distance_matrices=[ok_small.distance_matrix(0)[:num_locs, :num_locs]],
+        duration_matrices=[ok_small.duration_matrix(0)[:num_locs, :num_locs]],
+    )
+
+    with Solver(old) as solver:
+        res = solver.solve(MaxIterations(10))
+        assert_(res.best.is_complete())
+
+        # The best solution of the old instance is missing the new client,
+        # which the solver should insert when transferring it.
+        sols = solver.add_clients(ok_small, [res.best])
+        assert_equal(len(sols), 1)
+        assert_(sols[0].is_complete())
+        assert_equal(sols[0].num_clients(), ok_small.num_clients)
+
+        res = solver.solve(MaxIterations(10), initial_solutions=sols)
+        assert_(res.best.is_complete())
+        assert_equal(res.best.num_clients(), ok_small.num_clients)
+
+        # The solver is now on the new instance, which has more clients than
+        # the old instance. Going back is not possible.
+        with assert_raises(ValueError):
+            solver.add_clients(old)
+
+
+def test_solver_add_clients_opens_new_route(ok_small):
+    """
+    Tests that the solver inserts a new client into a new route of an unused
+    vehicle when that is much cheaper than inserting it into one of the
+    existing routes.
+    """
+    old = ok_small.replace(vehicle_types=[VehicleType(4, capacity=10)])
+
+    # The new client is close to the depot, but far from all other clients, so
+    # it should be visited by a separate route.
+    def extend(mat):
+        size = old.num_locations + 1
+        extended = np.full((size, size), 1_000)
+        extended[:-1, :-1] = mat
+        extended[0, -1] = extended[-1, 0] = 10
+        extended[-1, -1] = 0
+        return extended
+
+    new = old.replace(
+        clients=[*old.clients(), Client(x=0, y=0, delivery=1)],
+        distance_matrices=[extend(old.distance_matrix(0))],
+        duration_matrices=[extend(old.duration_matrix(0))],
+    )
+
+    with Solver(old) as solver:
+        res = solver.solve(MaxIterations(10))
+        assert_(res.best.num_routes() < old.num_vehicles)
+
+        sols = solver.add_clients(new, [res.best])
+        assert_(sols[0].is_complete())
+        assert_equal(sols[0].num_routes(), res.best.num_routes() + 1)
+        visits = [route.visits() for route in sols[0].routes()]
+        assert_([new.num_locations - 1] in visits)
+
+
+def test_solver_rejects_requests_for_previous_instance(ok_small):
+    """
+    Tests that a request that was submitted before the solver moved to a new
+    instance is not solved on that new instance, since its initial solutions
+    belong to the previous instance. Such requests only start after
+    add_clients() when they are queued behind running requests, which is hard
+    to arrange deterministically, so this calls the worker function directly.
+    """
+    num_locs = ok_small.num_locations - 1  # without the last client
+    old = ok_small.replace(
+        clients=ok_small.clients()[:-1],
+        distance_matrices=[ok_small.distance_matrix(0)[:num_locs, :num_locs]],
+        duration_matrices=[ok_small.duration_matrix(0)[:num_locs, :num_locs]],
+    )
+
+    with Solver(old) as solver:
+        res = solver.solve(MaxIterations(10))
+        solver.add_clients(ok_small)
+
+        args = (MaxIterations(10), 0, [res.best], False, False, [])
+        with assert_raises(ValueError):
+            solver._solve(old, *args)  # noqa: SLF001
+
+        # The solver can still serve requests for the new instance.
+        res = solver.solve(MaxIterations(10))
+        assert_equal(res.best.num_clients(), ok_small.num_clients)